@@ -1,7 +1,7 @@
 # ============================================
 # 构建辅助函数模块
 # ============================================
-# 功能：资源复制、DLL复制等构建辅助功能
+# 功能：资源复制、资源打包、音效预处理、DLL复制等构建辅助功能
 
 # ============================================
 # 配置资源文件复制
@@ -22,6 +22,57 @@ function(setup_asset_copy TARGET_NAME)
     )
 endfunction()
 
+# ============================================
+# 配置资源打包
+# 用法：setup_asset_pack(目标名称)
+# 构建 asset_packer 工具，并添加 pack_assets 目标：
+# 将 assets 目录打包为可执行文件旁的 assets.pak（游戏启动时若存在则优先从中读取）
+# ============================================
+function(setup_asset_pack TARGET_NAME)
+    add_executable(asset_packer ${CMAKE_SOURCE_DIR}/tools/asset_packer/asset_packer.cpp)
+    # 命令行工具：不使用 setup_compiler_options（其中 MSVC 设置了 WINDOWS 子系统）
+    if(MSVC)
+        target_compile_options(asset_packer PRIVATE /W4 /utf-8)
+    else()
+        target_compile_options(asset_packer PRIVATE -Wall -Wextra -Wpedantic)
+    endif()
+
+    add_custom_target(pack_assets
+        COMMAND asset_packer ${CMAKE_SOURCE_DIR}/assets $<TARGET_FILE_DIR:${TARGET_NAME}>/assets.pak
+        DEPENDS asset_packer ${TARGET_NAME}
+        COMMENT "Pack asset files into assets.pak"
+        VERBATIM
+    )
+endfunction()
+
+# ============================================
+# 配置音效预处理
+# 用法：setup_audio_cook()
+# 构建 audio_cooker 工具，并添加 cook_audio 目标：
+# 将资源映射中的音效转换为混音器设备格式的 PCM，输出到 assets/cooked/（随资源一起复制/打包）
+# ============================================
+function(setup_audio_cook)
+    add_executable(audio_cooker ${CMAKE_SOURCE_DIR}/tools/audio_cooker/audio_cooker.cpp)
+    target_link_libraries(audio_cooker
+        SDL3::SDL3
+        SDL3_mixer::SDL3_mixer
+        nlohmann_json::nlohmann_json
+    )
+    if(MSVC)
+        target_compile_options(audio_cooker PRIVATE /W4 /utf-8)
+    else()
+        target_compile_options(audio_cooker PRIVATE -Wall -Wextra -Wpedantic)
+    endif()
+
+    add_custom_target(cook_audio
+        COMMAND audio_cooker assets/data/resource_mapping.json
+        WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}
+        DEPENDS audio_cooker
+        COMMENT "Cook sound effects into device-format PCM"
+        VERBATIM
+    )
+endfunction()
+
 # ============================================
 # 配置Windows DLL复制
 # 用法：setup_windows_dll_copy(目标名称)
@@ -1,8 +1,13 @@
 #include "audio_player.h"
 #include "../resource/resource_manager.h"
+#include "../render/camera.h"
 #include <SDL3_mixer/SDL_mixer.h> 
+#include "../debug/log.h"
+#include "../debug/alloc_counter.h"
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <nlohmann/json.hpp>
 
 namespace engine::audio {
 AudioPlayer::~AudioPlayer() = default;
@@ -12,34 +17,142 @@ AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager)
     if (!resource_manager_) {
         throw std::runtime_error("AudioPlayer 构造失败: 提供的 ResourceManager 指针为空。");
     }
+    voice_manager_ = std::make_unique<VoiceManager>();
 }
 
 int AudioPlayer::playSound(std::string_view sound_path, int channel) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
 
     Mix_Chunk* chunk = resource_manager_->getSound(sound_path); // 通过 ResourceManager 获取资源
     if (!chunk) {
-        spdlog::error("AudioPlayer: 无法获取音效 '{}' 播放。", sound_path);
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "AudioPlayer: 无法获取音效 '{}' 播放。", sound_path);
         return -1;
     }
 
-    int played_channel = Mix_PlayChannel(channel, chunk, 0);    // 播放音效
-    if (played_channel == -1) {
-        spdlog::error("AudioPlayer: 无法播放音效 '{}': {}", sound_path, SDL_GetError());
-    } else {
+    int played_channel = voice_manager_->play(sound_path, chunk, {}, channel);  // 由 VoiceManager 分配通道并播放
+    if (played_channel != -1) {
          spdlog::trace("AudioPlayer: 播放音效 '{}' 在通道 {}。", sound_path, played_channel);
     }
     return played_channel;
 }
 
+int AudioPlayer::playSoundAt(std::string_view sound_path, const glm::vec2& position, const engine::render::Camera& camera,
+                             int channel) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
+    auto half_viewport = camera.getViewportSize() / 2.0f;
+    auto offset = position - (camera.getPosition() + half_viewport);   // 相对相机中心的偏移
+    float distance = glm::length(offset);
+    if (distance >= max_distance_) {
+        spdlog::trace("AudioPlayer: 音效 '{}' 超出范围 ({:.1f})，不播放。", sound_path, distance);
+        return -1;
+    }
+
+    SpatialParams spatial;
+    // 线性衰减：min_distance_ 内为 1，max_distance_ 处为 0
+    spatial.gain_ = 1.0f - glm::clamp((distance - min_distance_) / (max_distance_ - min_distance_), 0.0f, 1.0f);
+    spatial.pan_ = half_viewport.x > 0.0f ? glm::clamp(offset.x / half_viewport.x, -1.0f, 1.0f) : 0.0f;
+
+    Mix_Chunk* chunk = resource_manager_->getSound(sound_path);
+    if (!chunk) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "AudioPlayer: 无法获取音效 '{}' 播放。", sound_path);
+        return -1;
+    }
+    return voice_manager_->play(sound_path, chunk, spatial, channel);
+}
+
+void AudioPlayer::setSoundSettings(std::string_view sound_path, const SoundSettings& settings) {
+    voice_manager_->setSoundSettings(sound_path, settings);
+}
+
+bool AudioPlayer::loadSoundSettings(std::string_view config_path) {
+    auto text = resource_manager_->readTextFile(config_path);
+    if (!text) {
+        spdlog::warn("AudioPlayer: 无法打开音效配置文件: {}", config_path);
+        return false;
+    }
+    try {
+        nlohmann::json j = nlohmann::json::parse(*text);
+        if (!j.contains("sound_settings") || !j["sound_settings"].is_object()) return true;
+        for (const auto& [id, value] : j["sound_settings"].items()) {
+            if (!value.is_object()) {
+                spdlog::warn("AudioPlayer: 音效 '{}' 的播放策略格式错误，已忽略。", id);
+                continue;
+            }
+            SoundSettings settings;
+            settings.priority_ = value.value("priority", settings.priority_);
+            settings.max_instances_ = value.value("max_instances", settings.max_instances_);
+            // VoiceManager 按播放时传入的字符串区分音效：ID 与路径两种写法都登记
+            voice_manager_->setSoundSettings(id, settings);
+            if (auto path = resource_manager_->resolvePath(id); path != id) {
+                voice_manager_->setSoundSettings(path, settings);
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("AudioPlayer: 解析音效配置文件 '{}' 失败: {}", config_path, e.what());
+        return false;
+    }
+    spdlog::debug("AudioPlayer: 已读取音效播放策略 '{}'。", config_path);
+    return true;
+}
+
+void AudioPlayer::setCoalesceWindowMs(int ms) {
+    voice_manager_->setCoalesceWindowMs(ms);
+}
+
+void AudioPlayer::setSpatialRange(float min_distance, float max_distance) {
+    min_distance_ = glm::max(0.0f, min_distance);
+    max_distance_ = glm::max(min_distance_ + 1.0f, max_distance);
+}
+
+int AudioPlayer::getActiveVoiceCount() {
+    return voice_manager_->getActiveVoiceCount();
+}
+
 bool AudioPlayer::playMusic(std::string_view music_path, int loops, int fade_in_ms) {
-    if (music_path == current_music_) return true;      // 如果当前音乐已经在播放，则不重复播放
-    current_music_ = music_path;
-    Mix_Music* music = resource_manager_->getMusic(music_path); // 通过 ResourceManager 获取资源
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
+    std::string_view path = resource_manager_->resolvePath(music_path);
+    // 如果当前音乐已经在播放（或正在等待加载），则不重复播放
+    if (path == current_music_ && (Mix_PlayingMusic() || pending_music_)) return true;
+    current_music_ = path;
+
+    Mix_Music* music = resource_manager_->tryGetMusic(path);   // 非阻塞获取，未就绪时开始后台加载
     if (!music) {
-        spdlog::error("AudioPlayer: 无法获取音乐 '{}' 播放。", music_path);
-        return false;
+        if (!resource_manager_->isMusicPending(path)) {
+            spdlog::error("AudioPlayer: 无法获取音乐 '{}' 播放。", music_path);
+            current_music_.clear();
+            return false;
+        }
+        Mix_HaltMusic();        // 先停止之前的音乐，新音乐就绪后在 update() 中开始
+        pending_music_ = PendingMusic{std::string(path), loops, fade_in_ms};
+        spdlog::trace("AudioPlayer: 音乐 '{}' 正在后台加载，就绪后播放。", music_path);
+        return true;
+    }
+    pending_music_.reset();
+    return startMusic(music, path, loops, fade_in_ms);
+}
+
+void AudioPlayer::prefetchMusic(std::string_view music_path) {
+    resource_manager_->prefetchMusic(music_path);
+}
+
+void AudioPlayer::update() {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
+    resource_manager_->pollAsyncLoads();
+    if (!pending_music_) return;
+
+    Mix_Music* music = resource_manager_->tryGetMusic(pending_music_->path_);
+    if (music) {
+        auto pending = std::move(*pending_music_);
+        pending_music_.reset();
+        startMusic(music, pending.path_, pending.loops_, pending.fade_in_ms_);
+    } else if (!resource_manager_->isMusicPending(pending_music_->path_)) {
+        spdlog::error("AudioPlayer: 音乐 '{}' 加载失败，取消播放。", pending_music_->path_);
+        pending_music_.reset();
+        current_music_.clear();
     }
+}
 
+bool AudioPlayer::startMusic(Mix_Music* music, std::string_view music_path, int loops, int fade_in_ms) {
     Mix_HaltMusic();        // 停止之前的音乐
 
     bool result = false;
@@ -58,6 +171,8 @@ bool AudioPlayer::playMusic(std::string_view music_path, int loops, int fade_in_
 }
 
 void AudioPlayer::stopMusic(int fade_out_ms) {
+    pending_music_.reset();
+    current_music_.clear();
     if (fade_out_ms > 0) {
         Mix_FadeOutMusic(fade_out_ms);  // 淡出音乐
     } else {
@@ -78,6 +193,11 @@ void AudioPlayer::resumeMusic() {
 
 void AudioPlayer::setSoundVolume(float volume, int channel) {
     // 将浮点音量(0-1)转换为SDL_mixer的音量(0-128)
+    if (channel == -1) {        // 全局音量交给 VoiceManager，以保留各通道的距离衰减
+        voice_manager_->setSoundVolume(volume);
+        spdlog::trace("AudioPlayer: 设置音效音量为 {:.2f}。", volume);
+        return;
+    }
     int sdl_volume = static_cast<int>(glm::max(0.0f, glm::min(1.0f, volume)) * MIX_MAX_VOLUME);
     Mix_Volume(channel, sdl_volume);
     spdlog::trace("AudioPlayer: 设置通道 {} 的音量为 {:.2f}。", channel, volume);
@@ -96,6 +216,7 @@ float AudioPlayer::getMusicVolume() {
 }
 
 float AudioPlayer::getSoundVolume(int channel) {
+    if (channel == -1) return voice_manager_->getSoundVolume();
     return static_cast<float>(Mix_Volume(channel, -1)) / static_cast<float>(MIX_MAX_VOLUME);
 }
 
@@ -1,11 +1,19 @@
 #pragma once
+#include "voice_manager.h"
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <glm/vec2.hpp>
 
 namespace engine::resource {
     class ResourceManager;
 }
 
+namespace engine::render {
+    class Camera;
+}
+
 struct Mix_Chunk;
 struct Mix_Music;
 
@@ -22,6 +30,17 @@ private:
     engine::resource::ResourceManager* resource_manager_;   ///< @brief 指向 ResourceManager 的非拥有指针，用于加载和管理音频资源。
     std::string current_music_;         ///< @brief 当前正在播放的音乐路径，用于避免重复播放同一音乐。
 
+    /// @brief 等待后台加载完成后再开始播放的音乐请求
+    struct PendingMusic {
+        std::string path_;
+        int loops_ = -1;
+        int fade_in_ms_ = 0;
+    };
+    std::optional<PendingMusic> pending_music_;     ///< @brief 尚未就绪的音乐请求（只保留最新的一个）
+    std::unique_ptr<VoiceManager> voice_manager_;   ///< @brief 通道分配（优先级、实例上限、抢占与合并）
+    float min_distance_ = 100.0f;       ///< @brief 空间音效：此距离内不衰减
+    float max_distance_ = 400.0f;       ///< @brief 空间音效：超过此距离静音（不播放）
+
 public:
     /**
      * @brief 构造函数，使用 ResourceManager 初始化。
@@ -46,15 +65,54 @@ public:
     int playSound(std::string_view sound_path, int channel = -1);
 
     /**
-     * @brief 播放背景音乐。如果正在播放，则淡出之前的音乐。
-     * 如果尚未缓存，则通过 ResourceManager 加载音乐。
-     * @param music_path 音乐文件的路径。
+     * @brief 在世界坐标处播放音效，根据与相机中心的距离衰减音量，并按水平偏移设置左右声像。
+     * 超出最大距离时不播放。
+     * @param sound_path 音效文件的路径。
+     * @param position 声源的世界坐标。
+     * @param camera 当前相机。
+     * @param channel 要播放的特定通道，或 -1 表示由 VoiceManager 分配。默认为 -1。
+     * @return 音效正在播放的通道，未播放或出错时返回 -1。
+     */
+    int playSoundAt(std::string_view sound_path, const glm::vec2& position, const engine::render::Camera& camera,
+                    int channel = -1);
+
+    /**
+     * @brief 设置某个音效的播放策略（优先级与最大同时实例数）。
+     */
+    void setSoundSettings(std::string_view sound_path, const SoundSettings& settings);
+
+    /**
+     * @brief 从配置文件（如 assets/data/resource_mapping.json）的 "sound_settings" 读取各音效的播放策略。
+     *        键可以是音效ID或路径，ID 会同时按解析后的路径登记，两种播放方式都能命中。
+     * @param config_path 配置文件路径。
+     * @return 读取成功返回 true（没有 "sound_settings" 也视为成功），否则返回 false。
+     */
+    bool loadSoundSettings(std::string_view config_path);
+    void setCoalesceWindowMs(int ms);                               ///< @brief 设置重复音效的合并窗口（毫秒）
+    void setSpatialRange(float min_distance, float max_distance);   ///< @brief 设置空间音效的衰减范围
+    int getActiveVoiceCount();                                      ///< @brief 获取正在播放的音效数量
+
+    /**
+     * @brief 播放背景音乐。如果正在播放，则停止之前的音乐。
+     * 如果尚未缓存，则请求后台加载，并在加载完成后的某一帧（update() 中）开始播放，不会阻塞当前帧。
+     * @param music_path 音乐文件的路径或资源ID（见 resource_mapping.json）。
      * @param loops 循环次数（-1 无限循环，0 播放一次，1 播放两次，以此类推）。默认为 -1。
      * @param fade_in_ms 音乐淡入的时间（毫秒）（0 表示不淡入）。默认为 0。
-     * @return 成功返回 true，出错返回 false。
+     * @return 已开始播放或已排队等待加载返回 true，出错返回 false。
      */
     bool playMusic(std::string_view music_path, int loops = -1, int fade_in_ms = 0);
 
+    /**
+     * @brief 预取音乐（如关卡加载时预取 battle_bgm），之后的 playMusic 可以立即开始。
+     * @param music_path 音乐文件的路径或资源ID。
+     */
+    void prefetchMusic(std::string_view music_path);
+
+    /**
+     * @brief 每帧调用：接收后台加载完成的音乐，并开始播放等待中的音乐。
+     */
+    void update();
+
     /**
      * @brief 停止当前正在播放的背景音乐。
      * @param fade_out_ms 淡出时间（毫秒）（0 表示立即停止）。默认为 0。
@@ -97,6 +155,9 @@ public:
      */
     float getSoundVolume(int channel = -1);
 
+private:
+    bool startMusic(Mix_Music* music, std::string_view music_path, int loops, int fade_in_ms);  ///< @brief 立即开始播放已加载的音乐
+
 };
 
 } // namespace engine::audio
@@ -0,0 +1,166 @@
+#include "voice_manager.h"
+#include "../debug/log.h"
+#include <SDL3/SDL_timer.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+
+namespace engine::audio {
+
+VoiceManager::VoiceManager(int channel_count)
+{
+    int allocated = Mix_AllocateChannels(channel_count);
+    voices_.resize(static_cast<std::size_t>(allocated));
+    spdlog::trace("VoiceManager 构造成功，分配 {} 个混音通道。", allocated);
+}
+
+int VoiceManager::play(std::string_view sound_path, Mix_Chunk* chunk, const SpatialParams& spatial, int channel)
+{
+    if (!chunk) return -1;
+    // 各表都支持 string_view 直接查找，稳定播放时不再为每次调用构造临时 std::string
+    Uint64 now = SDL_GetTicksNS();
+    const auto& settings = getSettings(sound_path);
+
+    // 1. 合并：同一音效在窗口内重复触发，视为同一次播放
+    if (channel == -1 && coalesce_window_ns_ > 0) {
+        if (auto it = last_play_ns_.find(sound_path); it != last_play_ns_.end() && now - it->second < coalesce_window_ns_) {
+            for (int i = static_cast<int>(voices_.size()) - 1; i >= 0; --i) {
+                if (voices_[i].sound_ == sound_path && voices_[i].start_ns_ == it->second) return i;
+            }
+            return -1;
+        }
+    }
+
+    // 2. 选择通道：指定通道直接使用，否则按实例上限/空闲/抢占的顺序选择
+    if (channel < 0 || channel >= static_cast<int>(voices_.size())) {
+        if (channel >= static_cast<int>(voices_.size())) {
+            ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "VoiceManager: 通道 {} 超出范围，改为自动分配。", channel);
+        }
+        channel = findVictim(sound_path, settings.priority_, settings.max_instances_);
+        if (channel == -1) {
+            ENGINE_LOG_THROTTLED(spdlog::level::debug, 1000, "VoiceManager: 没有可抢占的通道，丢弃音效 '{}'。", sound_path);
+            return -1;
+        }
+    }
+    if (!voices_[channel].sound_.empty() && Mix_Playing(channel)) {
+        Mix_HaltChannel(channel);   // 抢占
+    }
+
+    // 3. 播放并设置音量/声像
+    applyVolume(channel, spatial.gain_, spatial.pan_);
+    int played_channel = Mix_PlayChannel(channel, chunk, 0);
+    if (played_channel == -1) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "VoiceManager: 无法播放音效 '{}': {}", sound_path, SDL_GetError());
+        voices_[channel].sound_.clear();    // 保留容量
+        return -1;
+    }
+
+    auto& voice = voices_[played_channel];
+    voice.sound_.assign(sound_path);        // 复用通道上字符串的容量
+    voice.priority_ = settings.priority_;
+    voice.gain_ = spatial.gain_;
+    voice.start_ns_ = now;
+    if (auto it = last_play_ns_.find(sound_path); it != last_play_ns_.end()) {
+        it->second = now;
+    } else {
+        last_play_ns_.emplace(sound_path, now);     // 每种音效只在第一次播放时插入
+    }
+    return played_channel;
+}
+
+void VoiceManager::setSoundSettings(std::string_view sound_path, const SoundSettings& settings)
+{
+    auto& stored = settings_[std::string(sound_path)];
+    stored = settings;
+    stored.max_instances_ = glm::max(1, stored.max_instances_);
+}
+
+void VoiceManager::setCoalesceWindowMs(int ms)
+{
+    coalesce_window_ns_ = static_cast<Uint64>(glm::max(0, ms)) * 1'000'000;
+}
+
+void VoiceManager::setSoundVolume(float volume)
+{
+    sound_volume_ = glm::clamp(volume, 0.0f, 1.0f);
+    for (std::size_t i = 0; i < voices_.size(); ++i) {
+        const float gain = voices_[i].sound_.empty() ? 1.0f : voices_[i].gain_;
+        Mix_Volume(static_cast<int>(i), static_cast<int>(sound_volume_ * gain * MIX_MAX_VOLUME));
+    }
+}
+
+int VoiceManager::getActiveVoiceCount()
+{
+    refreshVoices();
+    int count = 0;
+    for (const auto& voice : voices_) {
+        if (!voice.sound_.empty()) ++count;
+    }
+    return count;
+}
+
+const SoundSettings& VoiceManager::getSettings(std::string_view sound_path) const
+{
+    auto it = settings_.find(sound_path);
+    return it != settings_.end() ? it->second : default_settings_;
+}
+
+void VoiceManager::refreshVoices()
+{
+    for (std::size_t i = 0; i < voices_.size(); ++i) {
+        if (!voices_[i].sound_.empty() && !Mix_Playing(static_cast<int>(i))) {
+            voices_[i].sound_.clear();      // 标记为空闲，保留容量
+        }
+    }
+}
+
+int VoiceManager::findVictim(std::string_view sound_path, int priority, int max_instances)
+{
+    refreshVoices();
+
+    // 1. 达到该音效的实例上限：抢占它自己最旧的实例
+    int instances = 0;
+    int oldest_same = -1;
+    for (int i = 0; i < static_cast<int>(voices_.size()); ++i) {
+        if (voices_[i].sound_ != sound_path) continue;
+        ++instances;
+        if (oldest_same == -1 || voices_[i].start_ns_ < voices_[oldest_same].start_ns_) oldest_same = i;
+    }
+    if (instances >= max_instances) return oldest_same;
+
+    // 2. 空闲通道
+    for (int i = 0; i < static_cast<int>(voices_.size()); ++i) {
+        if (voices_[i].sound_.empty()) return i;
+    }
+
+    // 3. 抢占：优先级最低 → 增益最小 → 最旧，且不抢占更高优先级的声音
+    int victim = -1;
+    for (int i = 0; i < static_cast<int>(voices_.size()); ++i) {
+        const auto& voice = voices_[i];
+        if (voice.priority_ > priority) continue;
+        if (victim == -1) { victim = i; continue; }
+        const auto& best = voices_[victim];
+        if (voice.priority_ != best.priority_) {
+            if (voice.priority_ < best.priority_) victim = i;
+        } else if (voice.gain_ != best.gain_) {
+            if (voice.gain_ < best.gain_) victim = i;
+        } else if (voice.start_ns_ < best.start_ns_) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+void VoiceManager::applyVolume(int channel, float gain, float pan)
+{
+    gain = glm::clamp(gain, 0.0f, 1.0f);
+    pan = glm::clamp(pan, -1.0f, 1.0f);
+    Mix_Volume(channel, static_cast<int>(sound_volume_ * gain * MIX_MAX_VOLUME));
+
+    // 线性平衡：居中时左右均为 255（SDL_mixer 会自动注销该效果，没有额外开销）
+    auto left = static_cast<Uint8>(255.0f * (pan > 0.0f ? 1.0f - pan : 1.0f));
+    auto right = static_cast<Uint8>(255.0f * (pan < 0.0f ? 1.0f + pan : 1.0f));
+    Mix_SetPanning(channel, left, right);
+}
+
+} // namespace engine::audio
@@ -0,0 +1,92 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../utils/string_hash.h"
+
+struct Mix_Chunk;
+
+namespace engine::audio {
+
+/**
+ * @brief 单个音效的播放策略
+ */
+struct SoundSettings {
+    int priority_ = 0;          ///< @brief 优先级，数值越大越重要；通道不足时只会抢占优先级不高于自己的声音
+    int max_instances_ = 4;     ///< @brief 同一音效允许同时播放的最大数量
+};
+
+/**
+ * @brief 声音的空间参数（由相机与声源位置计算）
+ */
+struct SpatialParams {
+    float gain_ = 1.0f;         ///< @brief 距离衰减后的增益 (0~1)
+    float pan_ = 0.0f;          ///< @brief 声像 (-1 左 ~ 1 右)
+};
+
+/**
+ * @brief 管理 SDL_mixer 通道（"声部"）的分配。
+ *
+ * - 每个音效可设置优先级与最大同时实例数，超出实例数时抢占该音效最旧的实例；
+ * - 通道用尽时按 "优先级最低 → 增益最小 → 最旧" 的顺序抢占，不会抢占更高优先级的声音；
+ * - 同一音效在极短时间窗口内重复触发会被合并为一次（如一轮齐射的箭矢）；
+ * - 支持按增益与声像设置通道音量与左右声道。
+ * 仅供 AudioPlayer 内部使用。
+ */
+class VoiceManager final {
+private:
+    /// @brief 通道上正在播放的声音
+    struct Voice {
+        std::string sound_;         ///< @brief 音效路径（空表示通道空闲）
+        int priority_ = 0;          ///< @brief 播放时的优先级
+        float gain_ = 1.0f;         ///< @brief 播放时的增益
+        Uint64 start_ns_ = 0;       ///< @brief 开始播放的时间
+    };
+
+    std::vector<Voice> voices_;                                     ///< @brief 通道号 -> 声音
+    std::unordered_map<std::string, SoundSettings, engine::utils::StringHash, std::equal_to<>> settings_;  ///< @brief 音效路径 -> 播放策略
+    std::unordered_map<std::string, Uint64, engine::utils::StringHash, std::equal_to<>> last_play_ns_;    ///< @brief 音效路径 -> 最近一次开始播放的时间（用于合并）
+    SoundSettings default_settings_;                                ///< @brief 未单独设置的音效使用的策略
+    float sound_volume_ = 1.0f;                                     ///< @brief 全局音效音量 (0~1)
+    Uint64 coalesce_window_ns_ = 30'000'000;                        ///< @brief 合并窗口（默认 30ms）
+
+public:
+    /**
+     * @brief 构造函数，分配混音通道。
+     * @param channel_count 混音通道数量。
+     */
+    explicit VoiceManager(int channel_count = 32);
+
+    // 禁止拷贝和移动
+    VoiceManager(const VoiceManager&) = delete;
+    VoiceManager& operator=(const VoiceManager&) = delete;
+    VoiceManager(VoiceManager&&) = delete;
+    VoiceManager& operator=(VoiceManager&&) = delete;
+
+    /**
+     * @brief 按策略播放音效。
+     * @param sound_path 音效路径（用作策略与实例计数的键）。
+     * @param chunk 已加载的音效。
+     * @param spatial 增益与声像。
+     * @param channel 指定通道（-1 表示由管理器分配）。
+     * @return 播放所在的通道；被合并时返回已在播放的通道；被拒绝或出错返回 -1。
+     */
+    int play(std::string_view sound_path, Mix_Chunk* chunk, const SpatialParams& spatial = {}, int channel = -1);
+
+    void setSoundSettings(std::string_view sound_path, const SoundSettings& settings);   ///< @brief 设置某个音效的播放策略
+    void setDefaultSettings(const SoundSettings& settings) { default_settings_ = settings; }   ///< @brief 设置默认策略
+    void setCoalesceWindowMs(int ms);                               ///< @brief 设置合并窗口（毫秒，0 表示不合并）
+    void setSoundVolume(float volume);                              ///< @brief 设置全局音效音量（会重新应用到正在播放的通道）
+    float getSoundVolume() const { return sound_volume_; }          ///< @brief 获取全局音效音量
+    int getActiveVoiceCount();                                      ///< @brief 获取正在播放的声音数量
+
+private:
+    const SoundSettings& getSettings(std::string_view sound_path) const;    ///< @brief 获取音效策略（没有则返回默认策略）
+    void refreshVoices();                                           ///< @brief 将已播放完毕的通道标记为空闲
+    int findVictim(std::string_view sound_path, int priority, int max_instances);   ///< @brief 选择可用或可抢占的通道，没有则返回 -1
+    void applyVolume(int channel, float gain, float pan);           ///< @brief 设置通道音量与声像
+};
+
+} // namespace engine::audio
@@ -3,6 +3,7 @@
 #include "../object/game_object.h"
 #include "../audio/audio_player.h"
 #include "../render/camera.h"
+#include "../debug/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -30,19 +31,16 @@ void AudioComponent::init()
 void AudioComponent::playSound(std::string_view sound_id, int channel, bool use_spatial)
 {
     // 如果 sound_id 是音效 ID，则在查找在map中查找对应的路径； 没找到的话则把 sound_id 当作路径直接使用
-    auto sound_path = sound_id_to_path_.find(std::string(sound_id)) != sound_id_to_path_.end() ? sound_id_to_path_[std::string(sound_id)] : sound_id;
+    std::string_view sound_path = sound_id;
+    if (auto it = sound_id_to_path_.find(std::string(sound_id)); it != sound_id_to_path_.end()) {
+        sound_path = it->second;
+    } else {    // 每次播放都可能执行，节流输出
+        ENGINE_LOG_THROTTLED(spdlog::level::debug, 1000, "GameObject '{}' 中没有找到音效 ID '{}'，按路径播放。",
+                             owner_ ? owner_->getName() : "Unknown", sound_id);
+    }
 
-    if (use_spatial && transform_) {    // 使用空间定位
-        // TODO: (SDL_Mixer 不支持空间定位，未来更换音频库时可以方便地实现)
-                // 这里给一个简单的功能：150像素范围内播放，否则不播放
-        auto camera_center = camera_->getPosition() + camera_->getViewportSize() / 2.0f; // 相机中心
-        auto object_pos = transform_->getPosition();
-        float distance = glm::length(camera_center - object_pos);
-        if (distance > 150.0f) {
-            spdlog::debug("AudioComponent::playSound: 音效 '{}' 超出范围，不播放。", sound_id);
-            return; // 超出范围，不播放
-        }
-        audio_player_->playSound(sound_path, channel);
+    if (use_spatial && transform_ && camera_) {    // 使用空间定位（距离衰减 + 左右声像）
+        audio_player_->playSoundAt(sound_path, transform_->getPosition(), *camera_, channel);
     } else {    // 不使用空间定位
         audio_player_->playSound(sound_path, channel);
     }
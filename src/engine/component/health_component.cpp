@@ -1,16 +1,33 @@
 #include "health_component.h"
+#include "transform_component.h"
 #include "../../engine/object/game_object.h"
+#include "../../engine/core/context.h"
+#include "../../engine/render/text_renderer.h"
+#include "../../engine/utils/math.h"
+#include <charconv>
+#include <iterator>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
 namespace engine::component {
 
+namespace {
+constexpr float DAMAGE_NUMBER_DURATION = 0.8f;  ///< 伤害飘字存在时长（秒）
+constexpr float DAMAGE_NUMBER_RISE = 24.0f;     ///< 伤害飘字在存在期间上浮的总距离（像素）
+}
+
 HealthComponent::HealthComponent(int max_health, float invincibility_duration)
     : max_health_(glm::max(1, max_health)), // 确保最大生命值至少为 1
       current_health_(max_health_),         // 初始化当前生命值为最大生命值
       invincibility_duration_(invincibility_duration)
 {}
 
+void HealthComponent::init() {
+    if (owner_) {
+        transform_ = owner_->getComponent<TransformComponent>();
+    }
+}
+
 void HealthComponent::update(float delta_time, engine::core::Context&) {
     // 更新无敌状态计时器
     if (is_invincible_) {
@@ -20,6 +37,41 @@ void HealthComponent::update(float delta_time, engine::core::Context&) {
             invincibility_timer_ = 0.0f;
         }
     }
+    // 推进伤害飘字，移除过期的
+    for (auto& number : damage_numbers_) {
+        number.timer_ += delta_time;
+    }
+    std::erase_if(damage_numbers_, [](const DamageNumber& number) { return number.timer_ >= DAMAGE_NUMBER_DURATION; });
+}
+
+void HealthComponent::render(engine::core::Context& context) {
+    if (!transform_ || font_id_.empty() || (!show_label_ && damage_numbers_.empty())) {
+        return;
+    }
+    // 标签与飘字都进入文字批次，由 Scene::render 末尾的 flushBatchedText() 统一提交，
+    // 场景中无论多少个单位，同一字体只需一次绘制调用。
+    auto& text_renderer = context.getTextRenderer();
+    const auto& camera = context.getCamera();
+    const glm::vec2 anchor = transform_->getPosition() + label_offset_;
+
+    // 数字直接格式化到栈上缓冲区，避免每帧分配字符串
+    char buffer[32];
+    if (show_label_) {
+        char* end = std::to_chars(buffer, std::end(buffer), current_health_).ptr;
+        *end++ = '/';
+        end = std::to_chars(end, std::end(buffer), max_health_).ptr;
+        text_renderer.drawBatchedText(camera, std::string_view(buffer, end - buffer), font_id_, font_size_,
+                                      anchor, {1.0f, 1.0f, 1.0f, 1.0f});
+    }
+    for (const auto& number : damage_numbers_) {
+        const float progress = number.timer_ / DAMAGE_NUMBER_DURATION;
+        char* end = buffer;
+        *end++ = '-';
+        end = std::to_chars(end, std::end(buffer), number.amount_).ptr;
+        text_renderer.drawBatchedText(camera, std::string_view(buffer, end - buffer), font_id_, font_size_,
+                                      anchor - glm::vec2(0.0f, font_size_ + DAMAGE_NUMBER_RISE * progress),
+                                      {1.0f, 0.3f, 0.2f, 1.0f - progress});
+    }
 }
 
 bool HealthComponent::takeDamage(int damage_amount) {
@@ -34,6 +86,9 @@ bool HealthComponent::takeDamage(int damage_amount) {
     // --- 确实造成伤害了 ---
     current_health_ -= damage_amount;
     current_health_ = glm::max(0, current_health_); // 防止生命值变为负数
+    if (show_damage_numbers_) {
+        damage_numbers_.push_back({damage_amount, 0.0f});
+    }
     // 如果受伤但没死，并且设置了无敌时间，则触发无敌
     if (isAlive() && invincibility_duration_ > 0.0f) {
         setInvincible(invincibility_duration_);
@@ -1,7 +1,12 @@
 #pragma once
 #include "../../engine/component/component.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <glm/vec2.hpp>
 
 namespace engine::component {
+class TransformComponent;
 
 /**
  * @brief 管理 GameObject 的生命值，处理伤害、治疗，并提供无敌帧功能。
@@ -15,6 +20,19 @@ private:
     float invincibility_duration_ = 2.0f;   ///< @brief 受伤后无敌的总时长（秒）
     float invincibility_timer_ = 0.0f;      ///< @brief 无敌时间计时器（秒）
 
+    /// @brief 飘字：受到的伤害数值，在头顶上浮并淡出
+    struct DamageNumber {
+        int amount_ = 0;                    ///< @brief 伤害量
+        float timer_ = 0.0f;                ///< @brief 已存在时间（秒）
+    };
+    std::vector<DamageNumber> damage_numbers_;  ///< @brief 当前显示中的伤害飘字
+    bool show_label_ = false;               ///< @brief 是否在头顶显示生命值标签
+    bool show_damage_numbers_ = false;      ///< @brief 是否显示伤害飘字
+    std::string font_id_;                   ///< @brief 标签与飘字使用的字体路径（为空则不绘制文字）
+    int font_size_ = 16;                    ///< @brief 标签与飘字的字体大小
+    glm::vec2 label_offset_ = {0.0f, -12.0f};   ///< @brief 标签相对于 Transform 位置的偏移
+    TransformComponent* transform_ = nullptr;   ///< @brief 缓存的 TransformComponent 指针（非必需）
+
 public:
     /**
      * @brief 构造函数
@@ -50,10 +68,17 @@ public:
     void setMaxHealth(int max_health);                          ///< @brief 设置最大生命值 (确保不小于 1)。
     void setInvincible(float duration);                         ///< @brief 设置 GameObject 进入无敌状态，持续时间为 duration 秒。
     void setInvincibilityDuration(float duration) { invincibility_duration_ = duration; } ///< @brief 设置无敌状态持续时间。
+    void setShowLabel(bool show) { show_label_ = show; }                    ///< @brief 设置是否显示生命值标签。
+    void setShowDamageNumbers(bool show) { show_damage_numbers_ = show; }   ///< @brief 设置是否显示伤害飘字。
+    void setLabelOffset(const glm::vec2& offset) { label_offset_ = offset; } ///< @brief 设置标签相对于 Transform 位置的偏移。
+    /// @brief 设置标签与飘字的字体（由调用者提供，为空则不绘制文字）。
+    void setFont(std::string_view font_id, int font_size) { font_id_ = font_id; font_size_ = font_size; }
 
 protected:
     // 核心循环函数
+    void init() override;
     void update(float, engine::core::Context&) override;
+    void render(engine::core::Context&) override;       ///< @brief 生命值标签与伤害飘字（需先 setFont），走文字批次（每种字体一次绘制）
 };
 
 } // namespace engine::component
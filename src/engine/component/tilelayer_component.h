@@ -1,5 +1,6 @@
 #pragma once
 #include "../render/sprite.h"
+#include "../loader/tile_property_table.h"
 #include "component.h"
 #include <vector>
 #include <glm/vec2.hpp>
@@ -42,7 +43,10 @@ enum class TileType {
 struct TileInfo {
     render::Sprite sprite;      ///< @brief 瓦片的视觉表示
     TileType type;              ///< @brief 瓦片的逻辑类型
-    TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY) : sprite(std::move(s)), type(t) {}
+    engine::loader::TilePropertyTable::Index properties;    ///< @brief 自定义属性在 LevelLoader 属性表中的索引（同一图块的瓦片共享）
+    TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY,
+             engine::loader::TilePropertyTable::Index p = engine::loader::TilePropertyTable::EMPTY)
+        : sprite(std::move(s)), type(t), properties(p) {}
 };
 
 /**
@@ -107,6 +111,12 @@ public:
     void setOffset(glm::vec2 offset) { offset_ = std::move(offset); }       ///< @brief 设置瓦片层的偏移量
     void setHidden(bool hidden) { is_hidden_ = hidden; }                ///< @brief 设置是否隐藏（不渲染）
     void setPhysicsEngine(engine::physics::PhysicsEngine* physics_engine) {physics_engine_ = physics_engine; }
+    /// @brief 替换全部瓦片数据（热重载地图时使用）
+    void setTiles(glm::ivec2 tile_size, glm::ivec2 map_size, std::vector<TileInfo>&& tiles) {
+        tile_size_ = tile_size;
+        map_size_ = map_size;
+        tiles_ = std::move(tiles);
+    }
 
 protected:
     // 核心循环方法
@@ -2,6 +2,7 @@
 #include <fstream>
 #include <filesystem>
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include "spdlog/spdlog.h"
 
 namespace engine::core {
@@ -73,6 +74,8 @@ void Config::fromJson(const nlohmann::json& j) {
             spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
             target_fps_ = 0;
         }
+        texture_budget_mb_ = std::max(0, perf_config.value("texture_budget_mb", texture_budget_mb_));
+        sound_budget_mb_ = std::max(0, perf_config.value("sound_budget_mb", sound_budget_mb_));
     }
     if (j.contains("audio")) {
         const auto& audio_config = j["audio"];
@@ -109,7 +112,9 @@ nlohmann::ordered_json Config::toJson() const {
             {"vsync", vsync_enabled_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"texture_budget_mb", texture_budget_mb_},
+            {"sound_budget_mb", sound_budget_mb_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
@@ -27,6 +27,8 @@ public:
 
     // 性能设置
     int target_fps_ = 144;                  ///< @brief 目标 FPS 设置，0 表示不限制
+    int texture_budget_mb_ = 0;             ///< @brief 纹理缓存内存预算（MB），0 表示不限制
+    int sound_budget_mb_ = 0;               ///< @brief 音效缓存内存预算（MB），0 表示不限制
 
     // 音频设置
     float music_volume_ = 0.5f;
@@ -42,6 +44,7 @@ public:
         {"jump", {"J", "Space"}},
         {"attack", {"K", "MouseLeft"}},
         {"pause", {"P", "Escape"}},
+        {"toggle_debug", {"F1"}},           // 切换调试面板
         // 可以继续添加更多默认动作
     };
 
@@ -15,14 +15,16 @@ Context::Context(engine::input::InputManager& input_manager,
                  engine::render::TextRenderer& text_renderer,
                  engine::resource::ResourceManager& resource_manager,
                  engine::audio::AudioPlayer& audio_player,
-                 engine::core::GameState& game_state)     
+                 engine::core::GameState& game_state,
+                 engine::core::FrameArena& frame_arena)
     : input_manager_(input_manager),
       renderer_(renderer),
       camera_(camera),
       text_renderer_(text_renderer),
       resource_manager_(resource_manager),
       audio_player_(audio_player),
-      game_state_(game_state)
+      game_state_(game_state),
+      frame_arena_(frame_arena)
 {
     spdlog::trace("上下文已创建并初始化。");
 }
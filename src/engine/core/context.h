@@ -20,6 +20,7 @@ namespace engine::audio {
 
 namespace engine::core {
     class GameState;
+    class FrameArena;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象。
@@ -36,6 +37,7 @@ private:
     engine::resource::ResourceManager& resource_manager_;   ///< @brief 资源管理器
     engine::audio::AudioPlayer& audio_player_;              ///< @brief 音频播放器
     engine::core::GameState& game_state_;                   ///< @brief 游戏状态
+    engine::core::FrameArena& frame_arena_;                 ///< @brief 帧内存池（每帧开始时重置）
 public:
     /**
      * @brief 构造函数。
@@ -43,6 +45,7 @@ public:
      * @param renderer 对 Renderer 实例的引用。
      * @param camera 对 Camera 实例的引用。
      * @param resource_manager 对 ResourceManager 实例的引用。
+     * @param frame_arena 对 FrameArena 实例的引用。
      */
     Context(engine::input::InputManager& input_manager,
             engine::render::Renderer& renderer,
@@ -50,7 +53,8 @@ public:
             engine::render::TextRenderer& text_renderer,
             engine::resource::ResourceManager& resource_manager,
             engine::audio::AudioPlayer& audio_player,
-            engine::core::GameState& game_state);
+            engine::core::GameState& game_state,
+            engine::core::FrameArena& frame_arena);
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
     Context(const Context&) = delete;
@@ -66,6 +70,7 @@ public:
     engine::resource::ResourceManager& getResourceManager() const { return resource_manager_; } ///< @brief 获取资源管理器
     engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }                 ///< @brief 获取音频播放器
     engine::core::GameState& getGameState() const { return game_state_; }                         ///< @brief 获取游戏状态
+    engine::core::FrameArena& getFrameArena() const { return frame_arena_; }                     ///< @brief 获取帧内存池（帧内临时数据）
 };
 
 } // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "frame_arena.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <new>
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+FrameArena::FrameArena(std::size_t capacity)
+    : buffer_(std::make_unique<std::byte[]>(capacity)), capacity_(capacity) {
+    overflow_blocks_.reserve(16);
+    spdlog::trace("FrameArena 构造成功，容量: {} KB", capacity_ / 1024);
+}
+
+FrameArena::~FrameArena() {
+    reset();
+}
+
+void FrameArena::reset() {
+    const std::size_t used = getUsedBytes();
+    last_frame_bytes_ = used;
+    peak_bytes_ = std::max(peak_bytes_, used);
+
+    for (const auto& block : overflow_blocks_) {
+        ::operator delete(block.ptr_, block.bytes_, std::align_val_t(block.alignment_));
+    }
+    overflow_blocks_.clear();
+
+    // 本帧溢出：扩大缓冲区以容纳这一帧的全部用量，之后相同负载的帧不再溢出
+    if (overflow_bytes_ > 0) {
+        capacity_ = std::bit_ceil(used);
+        buffer_ = std::make_unique<std::byte[]>(capacity_);
+        ++grow_count_;
+        spdlog::debug("FrameArena 扩容至 {} KB", capacity_ / 1024);
+    }
+    offset_ = 0;
+    overflow_bytes_ = 0;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // 在缓冲区中按对齐要求移动偏移量
+    const auto base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+    const auto aligned = (base + offset_ + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t begin = aligned - base;
+    if (begin + bytes <= capacity_) {
+        offset_ = begin + bytes;
+        return buffer_.get() + begin;
+    }
+
+    // 缓冲区不足：临时从全局堆申请，重置时释放并扩容
+    void* ptr = ::operator new(bytes, std::align_val_t(alignment));
+    overflow_blocks_.push_back({ptr, bytes, alignment});
+    overflow_bytes_ += bytes;
+    return ptr;
+}
+
+} // namespace engine::core
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace engine::core {
+
+/**
+ * @brief 帧内存池：每帧开始时由 GameApp 重置的线性（bump）分配器，用于只在一帧内有效的临时数据。
+ *
+ * 作为 std::pmr::memory_resource 使用，可直接构造 std::pmr::vector / std::pmr::string 等容器，
+ * 分配只是移动偏移量，释放什么也不做，重置时整体回收。
+ * 缓冲区不够时临时向全局堆申请，并在下一次重置时把缓冲区扩大到本帧的用量，之后的帧不再产生堆分配。
+ * 只能在主线程使用；从中分配的内存不能跨帧保存。
+ */
+class FrameArena final : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 256 * 1024;    ///< @brief 默认缓冲区大小（字节）
+
+private:
+    /// @brief 缓冲区不足时从全局堆申请的内存块，重置时释放
+    struct OverflowBlock {
+        void* ptr_;
+        std::size_t bytes_;
+        std::size_t alignment_;
+    };
+
+    std::unique_ptr<std::byte[]> buffer_;           ///< @brief 缓冲区
+    std::size_t capacity_ = 0;                      ///< @brief 缓冲区大小
+    std::size_t offset_ = 0;                        ///< @brief 本帧已使用的字节数（下一次分配的位置）
+    std::size_t overflow_bytes_ = 0;                ///< @brief 本帧溢出到全局堆的字节数
+    std::vector<OverflowBlock> overflow_blocks_;    ///< @brief 本帧溢出的内存块
+
+    std::size_t last_frame_bytes_ = 0;              ///< @brief 上一帧的总用量（含溢出）
+    std::size_t peak_bytes_ = 0;                    ///< @brief 历史最大单帧用量
+    std::size_t grow_count_ = 0;                    ///< @brief 缓冲区扩容次数
+
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 初始缓冲区大小（字节）
+     */
+    explicit FrameArena(std::size_t capacity = DEFAULT_CAPACITY);
+    ~FrameArena() override;
+
+    // 禁止拷贝和移动
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    /**
+     * @brief 回收本帧的全部分配（每帧开始时调用）。本帧发生过溢出时扩大缓冲区。
+     */
+    void reset();
+
+    // --- 统计 ---
+    std::size_t getUsedBytes() const { return offset_ + overflow_bytes_; }  ///< @brief 本帧已使用的字节数
+    std::size_t getCapacity() const { return capacity_; }                   ///< @brief 缓冲区大小
+    std::size_t getLastFrameBytes() const { return last_frame_bytes_; }     ///< @brief 上一帧的用量
+    std::size_t getPeakBytes() const { return peak_bytes_; }                ///< @brief 历史最大单帧用量
+    std::size_t getGrowCount() const { return grow_count_; }                ///< @brief 缓冲区扩容次数
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}         ///< @brief 单独释放无操作，重置时整体回收
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+} // namespace engine::core
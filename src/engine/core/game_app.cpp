@@ -3,6 +3,7 @@
 #include "context.h"
 #include "config.h"
 #include "game_state.h"
+#include "frame_arena.h"
 #include "../resource/resource_manager.h"
 #include "../audio/audio_player.h"
 #include "../render/renderer.h"
@@ -10,6 +11,10 @@
 #include "../render/text_renderer.h"
 #include "../input/input_manager.h"
 #include "../scene/scene_manager.h"
+#include "../debug/debug_overlay.h"
+#include "../debug/scoped_timer.h"
+#include "../debug/file_watcher.h"
+#include "../debug/alloc_counter.h"
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
 
@@ -30,14 +35,25 @@ void GameApp::run() {
         return;
     }
 
+    engine::debug::markFrameThread();   // 每帧堆分配只统计主线程，日志与后台线程单独计数
     while (is_running_) {
+        text_renderer_->discardBatchedText();   // 文字批次的顶点来自帧内存池，重置前放弃
+        frame_arena_->reset();      // 回收上一帧的临时数据
+        const auto heap_allocs = engine::debug::getHeapAllocCount();
+        const auto background_allocs = engine::debug::getBackgroundHeapAllocCount();
         time_->update();
         float delta_time = time_->getDeltaTime();
-        input_manager_->update();   // 每帧首先更新输入管理器
-        
+        {
+            engine::debug::ScopedTimer timer(debug_overlay_->getFrameTimings().input_ms_);
+            input_manager_->update();   // 每帧首先更新输入管理器
+        }
+
         handleEvents();
         update(delta_time);
         render();
+        engine::debug::endAllocFrame();
+        debug_overlay_->recordFrame(time_->getUnscaledDeltaTime(), engine::debug::getHeapAllocCount() - heap_allocs,
+                                    engine::debug::getBackgroundHeapAllocCount() - background_allocs);
 
         // spdlog::info("delta_time: {}", delta_time);
     }
@@ -64,12 +80,15 @@ bool GameApp::init() {
     if (!initAudioPlayer()) return false;
     if (!initRenderer()) return false;
     if (!initCamera()) return false;
+    if (!initFrameArena()) return false;    // 文字渲染器的批次从帧内存池分配
     if (!initTextRenderer()) return false;
     if (!initInputManager()) return false;
     if (!initGameState()) return false;
 
     if (!initContext()) return false;
     if (!initSceneManager()) return false;
+    if (!initDebugOverlay()) return false;
+    if (!initFileWatcher()) return false;
 
     // 调用场景设置函数 (创建第一个场景并压入栈)
     scene_setup_func_(*scene_manager_);
@@ -86,22 +105,39 @@ void GameApp::handleEvents() {
         return;
     }
 
+    engine::debug::ScopedTimer timer(debug_overlay_->getFrameTimings().handle_input_ms_);
     scene_manager_->handleInput();
 }
 
 void GameApp::update(float delta_time) {
     // 游戏逻辑更新
+    engine::debug::ScopedTimer timer(debug_overlay_->getFrameTimings().update_ms_);
+    audio_player_->update();        // 接收后台加载的音乐，开始等待中的播放
+    if (file_watcher_) {            // 热重载磁盘上被修改的资源
+        for (const auto& path : file_watcher_->poll()) resource_manager_->reloadFile(path);
+    }
     scene_manager_->update(delta_time);
 }
 
 void GameApp::render() {
+    auto& timings = debug_overlay_->getFrameTimings();
+    renderer_->resetStats();
+    text_renderer_->resetStats();
+
     // 1. 清除屏幕
     renderer_->clearScreen();
 
     // 2. 具体渲染代码
-    scene_manager_->render();
+    {
+        engine::debug::ScopedTimer timer(timings.render_ms_);
+        scene_manager_->render();
+    }
 
-    // 3. 更新屏幕显示
+    // 3. 调试面板 (隐藏时直接返回)
+    debug_overlay_->render();
+
+    // 4. 更新屏幕显示
+    engine::debug::ScopedTimer timer(timings.present_ms_);
     renderer_->present();
 }
 
@@ -111,6 +147,9 @@ void GameApp::close() {
     scene_manager_->close();
 
     // 为了确保正确的销毁顺序，有些智能指针对象也需要手动管理
+    file_watcher_.reset();
+    debug_overlay_.reset();         // ImGui 后端依赖 SDL_Renderer，需在其销毁前关闭
+    text_renderer_->clearCache();   // 缓存的 TTF_Text 引用字体，需在字体释放前清空
     resource_manager_.reset();
 
     if (sdl_renderer_ != nullptr) {
@@ -185,6 +224,10 @@ bool GameApp::initTime() {
 bool GameApp::initResourceManager() {
     try {
         resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
+        resource_manager_->mountPack("assets.pak");      // 不存在时直接读取 assets 目录下的散文件
+        resource_manager_->loadResourceMapping("assets/data/resource_mapping.json");
+        resource_manager_->setTextureBudget(static_cast<std::size_t>(config_->texture_budget_mb_) * 1024 * 1024);
+        resource_manager_->setSoundBudget(static_cast<std::size_t>(config_->sound_budget_mb_) * 1024 * 1024);
     } catch (const std::exception& e) {
         spdlog::error("初始化资源管理器失败: {}", e.what());
         return false;
@@ -199,6 +242,7 @@ bool GameApp::initAudioPlayer()
         audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get());
         audio_player_->setMusicVolume(config_->music_volume_);      // 设置背景音乐音量
         audio_player_->setSoundVolume(config_->sound_volume_);      // 设置音效音量
+        audio_player_->loadSoundSettings("assets/data/resource_mapping.json");  // 各音效的优先级与实例上限
     } catch (const std::exception& e) {
         spdlog::error("初始化音频播放器失败: {}", e.what());
         return false;
@@ -232,7 +276,9 @@ bool GameApp::initCamera() {
 bool GameApp::initTextRenderer()
 {
     try {
-        text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get());
+        text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get(), frame_arena_.get());
+        // 字体因引用归零被卸载前，丢弃依赖它的文字缓存
+        resource_manager_->onFontRelease().connect<&engine::render::TextRenderer::releaseFont>(text_renderer_.get());
     } catch (const std::exception& e) {
         spdlog::error("初始化文字渲染引擎失败: {}", e.what());
         return false;
@@ -264,6 +310,17 @@ bool GameApp::initGameState()
     return true;
 }
 
+bool GameApp::initFrameArena()
+{
+    try {
+        frame_arena_ = std::make_unique<engine::core::FrameArena>();
+    } catch (const std::exception& e) {
+        spdlog::error("初始化帧内存池失败: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
 bool GameApp::initContext()
 {
     try {
@@ -273,7 +330,8 @@ bool GameApp::initContext()
                                                            *text_renderer_,
                                                            *resource_manager_, 
                                                            *audio_player_,
-                                                           *game_state_);
+                                                           *game_state_,
+                                                           *frame_arena_);
     } catch (const std::exception& e) {
         spdlog::error("初始化上下文失败: {}", e.what());
         return false;
@@ -293,4 +351,31 @@ bool GameApp::initSceneManager()
     return true;
 }
 
+bool GameApp::initDebugOverlay()
+{
+    try {
+        debug_overlay_ = std::make_unique<engine::debug::DebugOverlay>(window_, sdl_renderer_, *context_, *scene_manager_);
+    } catch (const std::exception& e) {
+        spdlog::error("初始化调试面板失败: {}", e.what());
+        return false;
+    }
+    input_manager_->onAction("toggle_debug").connect<&engine::debug::DebugOverlay::toggle>(debug_overlay_.get());
+    spdlog::trace("调试面板初始化成功。");
+    return true;
+}
+
+bool GameApp::initFileWatcher()
+{
+#ifndef NDEBUG
+    // 仅调试构建监视资源目录；失败不影响游戏运行
+    try {
+        file_watcher_ = std::make_unique<engine::debug::FileWatcher>("assets");
+    } catch (const std::exception& e) {
+        spdlog::warn("初始化文件监视器失败，资源热重载不可用: {}", e.what());
+        file_watcher_.reset();
+    }
+#endif
+    return true;
+}
+
 } // namespace engine::core
\ No newline at end of file
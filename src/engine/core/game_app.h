@@ -28,11 +28,17 @@ namespace engine::audio {
 class AudioPlayer;
 }
 
+namespace engine::debug {
+class DebugOverlay;
+class FileWatcher;
+}
+
 namespace engine::core {        // 命名空间的最佳实践：与文件路径一致
 class Time;
 class Config;
 class Context;
 class GameState;
+class FrameArena;
 
 /**
  * @brief 主游戏应用程序类，初始化SDL，管理游戏循环。
@@ -48,6 +54,7 @@ private:
 
     // 引擎组件
     std::unique_ptr<engine::core::Time> time_;
+    std::unique_ptr<engine::core::FrameArena> frame_arena_;         ///< @brief 帧内存池，每帧开始时重置（先于使用它的组件构造、后于它们析构）
     std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
     std::unique_ptr<engine::render::Renderer> renderer_;
     std::unique_ptr<engine::render::Camera> camera_;
@@ -58,6 +65,8 @@ private:
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;
     std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
     std::unique_ptr<engine::core::GameState> game_state_;
+    std::unique_ptr<engine::debug::DebugOverlay> debug_overlay_;
+    std::unique_ptr<engine::debug::FileWatcher> file_watcher_;      ///< @brief 资源热重载的文件监视器（仅调试构建）
 
 public:
     GameApp();
@@ -99,8 +108,11 @@ private:
     [[nodiscard]] bool initCamera();
     [[nodiscard]] bool initInputManager();
     [[nodiscard]] bool initGameState();
+    [[nodiscard]] bool initFrameArena();
     [[nodiscard]] bool initContext();
     [[nodiscard]] bool initSceneManager();
+    [[nodiscard]] bool initDebugOverlay();
+    [[nodiscard]] bool initFileWatcher();
 };
 
 } // namespace engine::core
@@ -0,0 +1,266 @@
+#include "alloc_counter.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+#include <spdlog/spdlog.h>
+
+#if !defined(NDEBUG) || defined(ENGINE_ALLOC_TRACKING)
+#define ENGINE_REPLACE_GLOBAL_NEW
+#endif
+
+namespace engine::debug {
+
+namespace {
+
+constexpr std::size_t TAG_COUNT = static_cast<std::size_t>(AllocTag::COUNT);
+constexpr std::array<std::string_view, TAG_COUNT> TAG_NAMES = {"untagged", "resource", "loader", "ecs", "ui", "audio"};
+
+std::atomic<std::uint64_t> heap_alloc_count{0};             ///< @brief 帧线程的分配次数
+std::atomic<std::uint64_t> background_heap_alloc_count{0};  ///< @brief 其他线程的分配次数
+thread_local AllocTag current_tag = AllocTag::UNTAGGED;
+thread_local bool is_frame_thread = false;
+
+void countHeapAlloc() {
+    (is_frame_thread ? heap_alloc_count : background_heap_alloc_count).fetch_add(1, std::memory_order_relaxed);
+}
+
+#ifdef ENGINE_ALLOC_TRACKING
+/// @brief 单个标签的计数器（所有线程并发更新）
+struct TagCounters {
+    std::atomic<std::int64_t> live_bytes_{0};
+    std::atomic<std::int64_t> peak_bytes_{0};
+    std::atomic<std::uint64_t> allocs_{0};
+    std::atomic<std::uint64_t> frame_allocs_{0};
+    std::atomic<std::uint64_t> frame_bytes_{0};
+};
+std::array<TagCounters, TAG_COUNT> tag_counters;
+
+/// @brief 上一帧的结果与单帧最大值（只在主线程读写）
+struct FrameRecord {
+    std::uint64_t allocs_ = 0;
+    std::uint64_t bytes_ = 0;
+    std::uint64_t max_bytes_ = 0;
+    std::uint64_t max_index_ = 0;
+};
+std::array<FrameRecord, TAG_COUNT> frame_records;
+std::uint64_t frame_index = 0;
+
+void recordAlloc(AllocTag tag, std::size_t size) {
+    auto& counters = tag_counters[static_cast<std::size_t>(tag)];
+    counters.allocs_.fetch_add(1, std::memory_order_relaxed);
+    counters.frame_allocs_.fetch_add(1, std::memory_order_relaxed);
+    counters.frame_bytes_.fetch_add(size, std::memory_order_relaxed);
+    const auto live = counters.live_bytes_.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed) +
+                      static_cast<std::int64_t>(size);
+    auto peak = counters.peak_bytes_.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peak_bytes_.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+void recordFree(AllocTag tag, std::size_t size) {
+    tag_counters[static_cast<std::size_t>(tag)].live_bytes_.fetch_sub(static_cast<std::int64_t>(size),
+                                                                      std::memory_order_relaxed);
+}
+#endif
+
+} // namespace
+
+AllocScope::AllocScope(AllocTag tag) : previous_(current_tag) {
+    current_tag = tag;
+}
+
+AllocScope::~AllocScope() {
+    current_tag = previous_;
+}
+
+void markFrameThread() {
+    is_frame_thread = true;
+}
+
+bool isHeapAllocCountEnabled() {
+#ifdef ENGINE_REPLACE_GLOBAL_NEW
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t getHeapAllocCount() {
+    return heap_alloc_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t getBackgroundHeapAllocCount() {
+    return background_heap_alloc_count.load(std::memory_order_relaxed);
+}
+
+bool isAllocTrackingEnabled() {
+#ifdef ENGINE_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string_view getAllocTagName(AllocTag tag) {
+    const auto index = static_cast<std::size_t>(tag);
+    return index < TAG_COUNT ? TAG_NAMES[index] : std::string_view("unknown");
+}
+
+AllocTagStats getAllocTagStats([[maybe_unused]] AllocTag tag) {
+    AllocTagStats stats;
+#ifdef ENGINE_ALLOC_TRACKING
+    const auto index = static_cast<std::size_t>(tag);
+    if (index >= TAG_COUNT) return stats;
+    const auto& counters = tag_counters[index];
+    const auto& record = frame_records[index];
+    stats.live_bytes_ = counters.live_bytes_.load(std::memory_order_relaxed);
+    stats.peak_bytes_ = counters.peak_bytes_.load(std::memory_order_relaxed);
+    stats.allocs_ = counters.allocs_.load(std::memory_order_relaxed);
+    stats.frame_allocs_ = record.allocs_;
+    stats.frame_bytes_ = record.bytes_;
+    stats.max_frame_bytes_ = record.max_bytes_;
+    stats.max_frame_index_ = record.max_index_;
+#endif
+    return stats;
+}
+
+void endAllocFrame() {
+#ifdef ENGINE_ALLOC_TRACKING
+    for (std::size_t i = 0; i < TAG_COUNT; ++i) {
+        auto& record = frame_records[i];
+        record.allocs_ = tag_counters[i].frame_allocs_.exchange(0, std::memory_order_relaxed);
+        record.bytes_ = tag_counters[i].frame_bytes_.exchange(0, std::memory_order_relaxed);
+        if (record.bytes_ > record.max_bytes_) {
+            record.max_bytes_ = record.bytes_;
+            record.max_index_ = frame_index;
+        }
+    }
+    ++frame_index;
+#endif
+}
+
+bool dumpAllocStats(std::string_view path) {
+    std::ofstream file{std::string(path), std::ios::trunc};
+    if (!file) {
+        spdlog::error("无法写入内存统计文件: {}", path);
+        return false;
+    }
+    if (!isAllocTrackingEnabled()) {
+        file << "内存跟踪未启用（使用 -DENGINE_ALLOC_TRACKING=ON 重新配置）\n";
+        file << "heap allocations: " << getHeapAllocCount() << "\n";
+        file << "background heap allocations: " << getBackgroundHeapAllocCount() << "\n";
+        return static_cast<bool>(file);
+    }
+
+    file << "tag\tlive_bytes\tpeak_bytes\tallocs\tlast_frame_allocs\tlast_frame_bytes\tmax_frame_bytes\tmax_frame\n";
+    for (std::size_t i = 0; i < TAG_COUNT; ++i) {
+        const auto tag = static_cast<AllocTag>(i);
+        const auto stats = getAllocTagStats(tag);
+        file << getAllocTagName(tag) << '\t' << stats.live_bytes_ << '\t' << stats.peak_bytes_ << '\t' << stats.allocs_
+             << '\t' << stats.frame_allocs_ << '\t' << stats.frame_bytes_ << '\t' << stats.max_frame_bytes_
+             << '\t' << stats.max_frame_index_ << '\n';
+    }
+    spdlog::info("内存统计已导出到 {}", path);
+    return static_cast<bool>(file);
+}
+
+} // namespace engine::debug
+
+#ifdef ENGINE_REPLACE_GLOBAL_NEW
+
+// --- 替换全局 operator new / delete（数组与 nothrow 版本默认转发到这里） ---
+
+namespace {
+
+void* alignedAllocRaw(std::size_t size, std::size_t alignment) {
+#ifdef _MSC_VER
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc 要求大小是对齐的整数倍
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void alignedFreeRaw(void* ptr) {
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#ifdef ENGINE_ALLOC_TRACKING
+/// @brief 跟踪模式下位于每块内存之前的记录
+struct alignas(std::max_align_t) AllocHeader {
+    std::size_t size_;
+    engine::debug::AllocTag tag_;
+};
+constexpr std::size_t HEADER_SIZE = sizeof(AllocHeader);
+
+/// @brief 用户指针之前的前缀大小：至少能放下记录，且保持用户指针的对齐
+std::size_t prefixSize(std::size_t alignment) {
+    return std::max(HEADER_SIZE, alignment);
+}
+
+void* allocate(std::size_t size, std::size_t alignment) {
+    if (size == 0) size = 1;
+    const std::size_t prefix = prefixSize(alignment);
+    void* base = alignment <= HEADER_SIZE ? std::malloc(prefix + size) : alignedAllocRaw(prefix + size, alignment);
+    if (!base) return nullptr;
+
+    auto* user = static_cast<std::byte*>(base) + prefix;
+    auto* header = reinterpret_cast<AllocHeader*>(user - HEADER_SIZE);
+    header->size_ = size;
+    header->tag_ = engine::debug::current_tag;
+    engine::debug::countHeapAlloc();
+    engine::debug::recordAlloc(header->tag_, size);
+    return user;
+}
+
+void deallocate(void* ptr, std::size_t alignment) {
+    if (!ptr) return;
+    auto* user = static_cast<std::byte*>(ptr);
+    const auto* header = reinterpret_cast<const AllocHeader*>(user - HEADER_SIZE);
+    engine::debug::recordFree(header->tag_, header->size_);   // 记入分配时的标签，而不是当前标签
+    void* base = user - prefixSize(alignment);
+    if (alignment <= HEADER_SIZE) std::free(base);
+    else alignedFreeRaw(base);
+}
+#else
+void* allocate(std::size_t size, std::size_t alignment) {
+    if (size == 0) size = 1;
+    engine::debug::countHeapAlloc();
+    return alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? std::malloc(size) : alignedAllocRaw(size, alignment);
+}
+
+void deallocate(void* ptr, std::size_t alignment) {
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) std::free(ptr);
+    else alignedFreeRaw(ptr);
+}
+#endif
+
+constexpr std::size_t DEFAULT_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = allocate(size, DEFAULT_ALIGNMENT)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = allocate(size, static_cast<std::size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr, DEFAULT_ALIGNMENT); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr, DEFAULT_ALIGNMENT); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { deallocate(ptr, static_cast<std::size_t>(alignment)); }
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace engine::debug {
+
+/**
+ * @brief 全局堆分配计数与按标签的内存统计。
+ *
+ * alloc_counter.cpp 替换了全局 operator new / delete：
+ * - 调试构建：统计分配次数，用于验证稳定运行的帧没有堆分配（帧内临时数据应使用 FrameArena），
+ *   帧线程与其他线程分开计数；
+ * - 定义了 ENGINE_ALLOC_TRACKING（CMake 选项，任意构建类型）：额外在每块内存前记录大小与标签，
+ *   按标签统计存活字节、峰值字节、分配次数以及每帧的分配量，由调试面板显示并可导出到文件。
+ * 只统计 C++ 的 new；SDL、ImGui 等通过 malloc 的分配（例如纹理像素）不在其中。
+ * 发布构建且未开启跟踪时不做替换，计数始终为 0。
+ */
+
+/// @brief 内存统计的标签（分配时所在的 AllocScope 决定）
+enum class AllocTag : std::uint8_t {
+    UNTAGGED,   ///< @brief 不在任何作用域内
+    RESOURCE,   ///< @brief 资源管理（纹理/字体等缓存的簿记）
+    LOADER,     ///< @brief 关卡加载与 JSON 文档
+    ECS,        ///< @brief 场景中的游戏对象与组件
+    UI,         ///< @brief UI 树
+    AUDIO,      ///< @brief 音频
+    COUNT
+};
+
+/// @brief 单个标签的统计
+struct AllocTagStats {
+    std::int64_t live_bytes_ = 0;           ///< @brief 当前存活字节
+    std::int64_t peak_bytes_ = 0;           ///< @brief 存活字节的峰值
+    std::uint64_t allocs_ = 0;              ///< @brief 累计分配次数
+    std::uint64_t frame_allocs_ = 0;        ///< @brief 上一帧的分配次数
+    std::uint64_t frame_bytes_ = 0;         ///< @brief 上一帧分配的字节数
+    std::uint64_t max_frame_bytes_ = 0;     ///< @brief 单帧分配字节数的最大值
+    std::uint64_t max_frame_index_ = 0;     ///< @brief 出现最大值的帧序号
+};
+
+/**
+ * @brief 作用域内（当前线程）的分配记入指定标签，可以嵌套，离开时恢复外层标签。
+ */
+class AllocScope final {
+private:
+    AllocTag previous_;     ///< @brief 外层标签
+
+public:
+    explicit AllocScope(AllocTag tag);
+    ~AllocScope();
+
+    // 禁止拷贝和移动
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+    AllocScope(AllocScope&&) = delete;
+    AllocScope& operator=(AllocScope&&) = delete;
+};
+
+/**
+ * @brief 把当前线程登记为帧线程（由 GameApp 在主循环开始前调用）。
+ *
+ * getHeapAllocCount() 只统计帧线程的分配，异步日志、后台加载、并行任务等其他线程
+ * 的分配记入 getBackgroundHeapAllocCount()，不影响"每帧零分配"的判断。
+ */
+void markFrameThread();
+
+bool isHeapAllocCountEnabled();                 ///< @brief 是否启用了计数（调试构建或开启跟踪）
+std::uint64_t getHeapAllocCount();              ///< @brief 程序启动以来帧线程的分配次数
+std::uint64_t getBackgroundHeapAllocCount();    ///< @brief 程序启动以来其他线程的分配次数
+
+bool isAllocTrackingEnabled();                  ///< @brief 是否启用了按标签统计 (ENGINE_ALLOC_TRACKING)
+std::string_view getAllocTagName(AllocTag tag); ///< @brief 标签名称
+AllocTagStats getAllocTagStats(AllocTag tag);   ///< @brief 获取标签的统计快照
+
+/**
+ * @brief 结束一帧的统计：把本帧的分配量记为"上一帧"并清零，更新单帧最大值。每帧由 GameApp 调用一次。
+ */
+void endAllocFrame();
+
+/**
+ * @brief 把各标签的统计导出为文本表格
+ * @param path 输出文件路径
+ * @return 是否写入成功
+ */
+bool dumpAllocStats(std::string_view path);
+
+} // namespace engine::debug
@@ -0,0 +1,333 @@
+#include "debug_overlay.h"
+#include "log.h"
+#include "alloc_counter.h"
+#include "../core/frame_arena.h"
+#include "../core/context.h"
+#include "../audio/audio_player.h"
+#include "../input/input_manager.h"
+#include "../render/renderer.h"
+#include "../render/text_renderer.h"
+#include "../resource/resource_manager.h"
+#include "../resource/asset_pack.h"
+#include "../scene/scene_manager.h"
+#include "../scene/scene.h"
+#include "../object/game_object.h"
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <imgui_impl_sdlrenderer3.h>
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <map>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::debug {
+
+namespace {
+constexpr const char* OVERLAY_FONT_PATH = "assets/fonts/VonwaonBitmap-16px.ttf";  ///< @brief 面板字体（需要支持中文）
+constexpr float OVERLAY_FONT_SIZE = 16.0f;
+constexpr const char* ALLOC_STATS_PATH = "alloc_stats.txt";    ///< @brief 内存统计的导出路径
+}
+
+DebugOverlay::DebugOverlay(SDL_Window* window, SDL_Renderer* sdl_renderer,
+                           engine::core::Context& context, engine::scene::SceneManager& scene_manager)
+    : window_(window), sdl_renderer_(sdl_renderer), context_(context), scene_manager_(scene_manager)
+{
+    if (!window_ || !sdl_renderer_) {
+        throw std::runtime_error("DebugOverlay 构造失败: SDL_Window 或 SDL_Renderer 为空指针。");
+    }
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    ImGui::StyleColorsDark();
+
+    // 默认字体不包含中文字形，优先使用游戏自带的字体（1.92 起字形按需加载）
+    if (std::filesystem::exists(OVERLAY_FONT_PATH)) {
+        io.Fonts->AddFontFromFileTTF(OVERLAY_FONT_PATH, OVERLAY_FONT_SIZE);
+    } else {
+        spdlog::warn("调试面板字体 '{}' 不存在，使用 ImGui 默认字体。", OVERLAY_FONT_PATH);
+    }
+
+    if (!ImGui_ImplSDL3_InitForSDLRenderer(window_, sdl_renderer_)) {
+        ImGui::DestroyContext();
+        throw std::runtime_error("DebugOverlay 构造失败: ImGui_ImplSDL3_InitForSDLRenderer 失败。");
+    }
+    if (!ImGui_ImplSDLRenderer3_Init(sdl_renderer_)) {
+        ImGui_ImplSDL3_Shutdown();
+        ImGui::DestroyContext();
+        throw std::runtime_error("DebugOverlay 构造失败: ImGui_ImplSDLRenderer3_Init 失败。");
+    }
+
+    // InputManager 负责轮询 SDL 事件，这里订阅原始事件转发给 ImGui
+    context_.getInputManager().onEvent().connect<&DebugOverlay::processEvent>(this);
+    spdlog::trace("DebugOverlay 构造成功。");
+}
+
+DebugOverlay::~DebugOverlay()
+{
+    context_.getInputManager().onEvent().disconnect(this);
+    ImGui_ImplSDLRenderer3_Shutdown();
+    ImGui_ImplSDL3_Shutdown();
+    ImGui::DestroyContext();
+    spdlog::trace("DebugOverlay 已销毁。");
+}
+
+void DebugOverlay::recordFrame(float frame_seconds, std::uint64_t heap_allocs, std::uint64_t background_allocs)
+{
+    frame_times_[frame_index_] = frame_seconds * 1000.0f;
+    if (isAllocTrackingEnabled()) {
+        std::uint64_t frame_bytes = 0;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(AllocTag::COUNT); ++i) {
+            frame_bytes += getAllocTagStats(static_cast<AllocTag>(i)).frame_bytes_;
+        }
+        alloc_kb_[frame_index_] = static_cast<float>(frame_bytes) / 1024.0f;
+    }
+    frame_index_ = (frame_index_ + 1) % FRAME_HISTORY_SIZE;
+    frame_heap_allocs_ = heap_allocs;
+    zero_alloc_frames_ = heap_allocs == 0 ? zero_alloc_frames_ + 1 : 0;
+    frame_background_allocs_ = background_allocs;
+}
+
+void DebugOverlay::processEvent(const SDL_Event& event)
+{
+    ImGui_ImplSDL3_ProcessEvent(&event);
+}
+
+void DebugOverlay::render()
+{
+    if (!visible_) return;
+
+    ImGui_ImplSDLRenderer3_NewFrame();
+    ImGui_ImplSDL3_NewFrame();
+    ImGui::NewFrame();
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(360.0f, 520.0f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("性能面板")) {
+        drawFrameSection();
+        drawRenderSection();
+        drawMemorySection();
+        drawSceneSection();
+        drawResourceSection();
+        drawLogSection();
+    }
+    ImGui::End();
+
+    ImGui::Render();
+
+    // ImGui 使用窗口坐标绘制，需要暂时关闭逻辑分辨率，绘制完成后恢复
+    int logical_w = 0, logical_h = 0;
+    SDL_RendererLogicalPresentation mode = SDL_LOGICAL_PRESENTATION_DISABLED;
+    SDL_GetRenderLogicalPresentation(sdl_renderer_, &logical_w, &logical_h, &mode);
+    SDL_SetRenderLogicalPresentation(sdl_renderer_, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED);
+    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), sdl_renderer_);
+    SDL_SetRenderLogicalPresentation(sdl_renderer_, logical_w, logical_h, mode);
+}
+
+void DebugOverlay::drawFrameSection()
+{
+    if (!ImGui::CollapsingHeader("帧时间", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+    // 最近一帧位于 frame_index_ - 1
+    float last_ms = frame_times_[(frame_index_ + FRAME_HISTORY_SIZE - 1) % FRAME_HISTORY_SIZE];
+    float max_ms = 0.0f, sum_ms = 0.0f;
+    for (float ms : frame_times_) {
+        max_ms = ms > max_ms ? ms : max_ms;
+        sum_ms += ms;
+    }
+    float avg_ms = sum_ms / static_cast<float>(FRAME_HISTORY_SIZE);
+
+    ImGui::Text("FPS: %.1f  当前: %.2f ms  平均: %.2f ms  最大: %.2f ms",
+                avg_ms > 0.0f ? 1000.0f / avg_ms : 0.0f, last_ms, avg_ms, max_ms);
+    ImGui::PlotLines("##frame_times", frame_times_.data(), static_cast<int>(FRAME_HISTORY_SIZE),
+                     static_cast<int>(frame_index_), nullptr, 0.0f, max_ms * 1.2f, ImVec2(-1.0f, 60.0f));
+
+    if (ImGui::BeginTable("##timings", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        auto row = [](const char* name, float ms) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f ms", ms);
+        };
+        row("输入更新", timings_.input_ms_);
+        row("场景输入", timings_.handle_input_ms_);
+        row("场景更新", timings_.update_ms_);
+        row("场景渲染", timings_.render_ms_);
+        row("呈现", timings_.present_ms_);
+        ImGui::EndTable();
+    }
+}
+
+void DebugOverlay::drawRenderSection()
+{
+    if (!ImGui::CollapsingHeader("渲染", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+    const auto& stats = context_.getRenderer().getStats();
+    ImGui::Text("精灵/矩形绘制调用: %d", stats.draw_calls_);
+    ImGui::Text("批次 (纹理切换): %d", stats.batches_);
+    ImGui::Text("文字绘制调用: %d", context_.getTextRenderer().getDrawCallCount());
+}
+
+void DebugOverlay::drawMemorySection()
+{
+    if (!ImGui::CollapsingHeader("内存", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+    constexpr float KB = 1024.0f;
+    const auto& arena = context_.getFrameArena();
+    ImGui::Text("帧内存池: 上一帧 %.1f KB / 容量 %.1f KB", arena.getLastFrameBytes() / KB, arena.getCapacity() / KB);
+    ImGui::Text("峰值: %.1f KB  扩容: %zu 次", arena.getPeakBytes() / KB, arena.getGrowCount());
+    if (isHeapAllocCountEnabled()) {
+        ImGui::Text("每帧堆分配: %llu  连续零分配帧: %llu", static_cast<unsigned long long>(frame_heap_allocs_),
+                    static_cast<unsigned long long>(zero_alloc_frames_));
+        ImGui::Text("其他线程: %llu", static_cast<unsigned long long>(frame_background_allocs_));
+    } else {
+        ImGui::TextUnformatted("每帧堆分配: 仅调试构建统计");
+    }
+
+    if (!isAllocTrackingEnabled()) {
+        ImGui::TextUnformatted("按标签统计: 未启用 (ENGINE_ALLOC_TRACKING)");
+        return;
+    }
+
+    // 每帧分配量曲线：关卡加载、刷怪等尖峰一目了然
+    float max_kb = 0.0f;
+    for (float kb : alloc_kb_) max_kb = kb > max_kb ? kb : max_kb;
+    ImGui::Text("每帧分配 (KB)，最大 %.1f", max_kb);
+    ImGui::PlotHistogram("##alloc_kb", alloc_kb_.data(), static_cast<int>(FRAME_HISTORY_SIZE),
+                         static_cast<int>(frame_index_), nullptr, 0.0f, max_kb * 1.2f + 1.0f, ImVec2(-1.0f, 50.0f));
+
+    if (ImGui::BeginTable("##alloc_tags", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("标签");
+        ImGui::TableSetupColumn("存活(KB)");
+        ImGui::TableSetupColumn("峰值(KB)");
+        ImGui::TableSetupColumn("分配次数");
+        ImGui::TableSetupColumn("本帧(KB)");
+        ImGui::TableSetupColumn("单帧最大(KB)");
+        ImGui::TableHeadersRow();
+        for (std::size_t i = 0; i < static_cast<std::size_t>(AllocTag::COUNT); ++i) {
+            const auto tag = static_cast<AllocTag>(i);
+            const auto stats = getAllocTagStats(tag);
+            const auto name = getAllocTagName(tag);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(name.data(), name.data() + name.size());
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.live_bytes_ / KB);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.peak_bytes_ / KB);
+            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(stats.allocs_));
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.frame_bytes_ / KB);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.max_frame_bytes_ / KB);
+        }
+        ImGui::EndTable();
+    }
+    if (ImGui::Button("导出到文件")) {
+        dumpAllocStats(ALLOC_STATS_PATH);
+    }
+}
+
+void DebugOverlay::drawSceneSection()
+{
+    if (!ImGui::CollapsingHeader("场景", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+    auto* scene = scene_manager_.getCurrentScene();
+    if (!scene) {
+        ImGui::TextUnformatted("无活动场景");
+        return;
+    }
+
+    const auto& game_objects = scene->getGameObjects();
+    const std::string_view scene_name = scene->getName();
+    ImGui::Text("场景: %.*s", static_cast<int>(scene_name.size()), scene_name.data());
+    ImGui::Text("游戏对象: %zu", game_objects.size());
+
+    // 按组件类型统计（仅在面板可见时计算，临时数据放在帧内存池中）
+    std::pmr::map<std::string_view, std::size_t> pool_counts(&context_.getFrameArena());
+    for (const auto& game_object : game_objects) {
+        for (const auto& [type_index, component] : game_object->getComponents()) {
+            ++pool_counts[type_index.name()];
+        }
+    }
+    if (ImGui::BeginTable("##pools", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        for (const auto& [type_name, count] : pool_counts) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(type_name.data(), type_name.data() + type_name.size());
+            ImGui::TableNextColumn(); ImGui::Text("%zu", count);
+        }
+        ImGui::EndTable();
+    }
+}
+
+void DebugOverlay::drawResourceSection()
+{
+    if (!ImGui::CollapsingHeader("资源缓存", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+    auto& resource_manager = context_.getResourceManager();
+    if (ImGui::BeginTable("##caches", 8, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("类型");
+        ImGui::TableSetupColumn("数量");
+        ImGui::TableSetupColumn("命中");
+        ImGui::TableSetupColumn("未命中");
+        ImGui::TableSetupColumn("命中率");
+        ImGui::TableSetupColumn("内存(MB)");
+        ImGui::TableSetupColumn("预算(MB)");
+        ImGui::TableSetupColumn("淘汰");
+        ImGui::TableHeadersRow();
+
+        auto row = [](const char* name, const engine::resource::CacheStats& stats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", stats.entries_);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", stats.hits_);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", stats.misses_);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f%%", stats.hitRate() * 100.0f);
+            constexpr float MB = 1024.0f * 1024.0f;
+            ImGui::TableNextColumn(); if (stats.bytes_ > 0) ImGui::Text("%.1f", stats.bytes_ / MB); else ImGui::TextUnformatted("-");
+            ImGui::TableNextColumn(); if (stats.budget_bytes_ > 0) ImGui::Text("%.1f", stats.budget_bytes_ / MB); else ImGui::TextUnformatted("-");
+            ImGui::TableNextColumn(); ImGui::Text("%zu", stats.evictions_);
+        };
+        row("纹理", resource_manager.getTextureStats());
+        row("音效", resource_manager.getSoundStats());
+        row("音乐", resource_manager.getMusicStats());
+        row("字体", resource_manager.getFontStats());
+        row("文字排版", context_.getTextRenderer().getCacheStats());
+        ImGui::EndTable();
+    }
+    ImGui::Text("正在播放的音效: %d", context_.getAudioPlayer().getActiveVoiceCount());
+    const auto& pack = resource_manager.getAssetPack();
+    if (pack.isMounted()) {
+        ImGui::Text("资源包: %zu 个文件，%.1f MB（内存映射）", pack.getFileCount(), pack.getMappedSize() / (1024.0 * 1024.0));
+    } else {
+        ImGui::TextUnformatted("资源包: 未挂载（读取散文件）");
+    }
+}
+
+void DebugOverlay::drawLogSection()
+{
+    if (!ImGui::CollapsingHeader("日志")) return;
+
+    ImGui::Text("异步队列溢出丢弃: %zu", getDroppedLogCount());
+    if (ImGui::BeginTable("##log_sites", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("调用点");
+        ImGui::TableSetupColumn("调用");
+        ImGui::TableSetupColumn("输出");
+        ImGui::TableSetupColumn("抑制");
+        ImGui::TableHeadersRow();
+        std::pmr::vector<const LogSite*> sites(&context_.getFrameArena());
+        getLogSites(sites);
+        for (const auto* site : sites) {
+            std::string_view file = site->getFile();
+            if (auto slash = file.find_last_of("/\\"); slash != std::string_view::npos) file.remove_prefix(slash + 1);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%.*s:%d", static_cast<int>(file.size()), file.data(), site->getLine());
+            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(site->getCalls()));
+            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(site->getEmitted()));
+            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(site->getSuppressed()));
+        }
+        ImGui::EndTable();
+    }
+}
+
+} // namespace engine::debug
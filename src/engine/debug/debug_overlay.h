@@ -0,0 +1,102 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// 前向声明
+struct SDL_Window;
+struct SDL_Renderer;
+union SDL_Event;
+
+namespace engine::core {
+class Context;
+}
+
+namespace engine::scene {
+class SceneManager;
+}
+
+namespace engine::debug {
+
+/**
+ * @brief 每帧各阶段耗时（毫秒），由 GameApp 通过 ScopedTimer 填写。
+ */
+struct FrameTimings {
+    float input_ms_ = 0.0f;         ///< @brief 输入更新（事件轮询、动作回调）
+    float handle_input_ms_ = 0.0f;  ///< @brief 场景输入处理
+    float update_ms_ = 0.0f;        ///< @brief 场景逻辑更新
+    float render_ms_ = 0.0f;        ///< @brief 场景渲染（提交绘制命令）
+    float present_ms_ = 0.0f;       ///< @brief 呈现（可能包含等待垂直同步）
+};
+
+/**
+ * @brief 基于 ImGui (sdl3 + sdlrenderer3 后端) 的性能调试面板。
+ *
+ * 显示帧时间曲线、各阶段耗时、绘制调用与批次数、帧内存池与每帧堆分配（开启跟踪时按标签统计并可导出）、当前场景各组件池的数量，
+ * 纹理/音效/音乐/字体缓存的大小与命中率，以及节流日志各调用点的计数。通过 "toggle_debug" 动作切换显示。
+ * 隐藏时不会开始 ImGui 帧，开销可以忽略。构造失败会抛出异常。
+ */
+class DebugOverlay final {
+private:
+    static constexpr std::size_t FRAME_HISTORY_SIZE = 240;  ///< @brief 帧时间曲线保存的帧数
+
+    SDL_Window* window_ = nullptr;                          ///< @brief 窗口的非拥有指针
+    SDL_Renderer* sdl_renderer_ = nullptr;                  ///< @brief 渲染器的非拥有指针
+    engine::core::Context& context_;                        ///< @brief 引擎上下文（读取各模块统计）
+    engine::scene::SceneManager& scene_manager_;            ///< @brief 场景管理器（统计当前场景对象）
+
+    bool visible_ = false;                                  ///< @brief 是否显示
+    FrameTimings timings_;                                  ///< @brief 本帧各阶段耗时
+    std::array<float, FRAME_HISTORY_SIZE> frame_times_{};   ///< @brief 帧时间历史（环形缓冲，毫秒）
+    std::size_t frame_index_ = 0;                           ///< @brief 下一个写入位置
+    std::uint64_t frame_heap_allocs_ = 0;                   ///< @brief 最近一帧的堆分配次数（仅调试构建统计）
+    std::uint64_t zero_alloc_frames_ = 0;                   ///< @brief 连续没有堆分配的帧数
+    std::uint64_t frame_background_allocs_ = 0;             ///< @brief 最近一帧其他线程（日志、后台加载）的堆分配次数
+    std::array<float, FRAME_HISTORY_SIZE> alloc_kb_{};      ///< @brief 每帧分配量历史（环形缓冲，KB，需开启内存跟踪）
+
+public:
+    /**
+     * @brief 构造函数，创建 ImGui 上下文并初始化 SDL3 平台后端与 SDL_Renderer 渲染后端。
+     * @param window 有效的 SDL_Window 指针。
+     * @param sdl_renderer 有效的 SDL_Renderer 指针。
+     * @param context 引擎上下文。
+     * @param scene_manager 场景管理器。
+     * @throws std::runtime_error 如果指针为空或后端初始化失败。
+     */
+    DebugOverlay(SDL_Window* window, SDL_Renderer* sdl_renderer,
+                 engine::core::Context& context, engine::scene::SceneManager& scene_manager);
+    ~DebugOverlay();            ///< @brief 断开事件订阅，关闭 ImGui 后端并销毁上下文
+
+    // 禁止拷贝和移动
+    DebugOverlay(const DebugOverlay&) = delete;
+    DebugOverlay& operator=(const DebugOverlay&) = delete;
+    DebugOverlay(DebugOverlay&&) = delete;
+    DebugOverlay& operator=(DebugOverlay&&) = delete;
+
+    /**
+     * @brief 记录一帧的总耗时（用于帧时间曲线）与堆分配次数。每帧调用一次。
+     * @param frame_seconds 未缩放的帧间时间（秒）
+     * @param heap_allocs 本帧主线程的堆分配次数（见 alloc_counter.h）
+     * @param background_allocs 本帧其他线程的堆分配次数
+     */
+    void recordFrame(float frame_seconds, std::uint64_t heap_allocs = 0, std::uint64_t background_allocs = 0);
+
+    void render();                                          ///< @brief 绘制调试面板（在场景渲染之后、present 之前调用）
+
+    void toggle() { visible_ = !visible_; }                 ///< @brief 切换显示/隐藏
+    void setVisible(bool visible) { visible_ = visible; }   ///< @brief 设置是否显示
+    bool isVisible() const { return visible_; }             ///< @brief 获取是否显示
+    FrameTimings& getFrameTimings() { return timings_; }    ///< @brief 获取本帧耗时（供 GameApp 写入）
+
+private:
+    void processEvent(const SDL_Event& event);              ///< @brief 将 SDL 事件转发给 ImGui（订阅 InputManager::onEvent）
+
+    void drawFrameSection();                                ///< @brief 帧时间曲线与各阶段耗时
+    void drawRenderSection();                               ///< @brief 绘制调用与批次
+    void drawMemorySection();                               ///< @brief 帧内存池与每帧堆分配
+    void drawSceneSection();                                ///< @brief 当前场景的对象与组件池数量
+    void drawResourceSection();                             ///< @brief 资源缓存大小与命中率
+    void drawLogSection();                                  ///< @brief 节流日志各调用点的计数
+};
+
+} // namespace engine::debug
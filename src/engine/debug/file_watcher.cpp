@@ -0,0 +1,112 @@
+#include "file_watcher.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace engine::debug {
+
+#ifdef __linux__
+
+namespace {
+// 编辑器保存文件通常是"写入后关闭"或"写入临时文件后改名"，两种都只在完成时报告一次
+constexpr std::uint32_t FILE_EVENTS = IN_CLOSE_WRITE | IN_MOVED_TO;
+constexpr std::uint32_t DIR_EVENTS = IN_CREATE | IN_DELETE_SELF;
+} // namespace
+
+FileWatcher::FileWatcher(std::string_view root_dir) : root_dir_(root_dir)
+{
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+        throw std::runtime_error(std::string("FileWatcher 构造失败: inotify_init1 错误: ") + std::strerror(errno));
+    }
+    addWatchRecursive(root_dir_);
+    spdlog::info("FileWatcher: 正在监视 '{}'（{} 个目录），修改的资源将被热重载。", root_dir_, watch_dirs_.size());
+}
+
+FileWatcher::~FileWatcher()
+{
+    if (fd_ >= 0) ::close(fd_);     // 关闭描述符会移除所有监视
+}
+
+std::vector<std::string> FileWatcher::poll()
+{
+    std::vector<std::string> changed;
+    if (fd_ < 0) return changed;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t length = ::read(fd_, buffer, sizeof(buffer));
+        if (length <= 0) break;     // EAGAIN：没有更多事件
+
+        for (char* ptr = buffer; ptr < buffer + length; ) {
+            auto* event = reinterpret_cast<inotify_event*>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+
+            auto dir_it = watch_dirs_.find(event->wd);
+            if (dir_it == watch_dirs_.end()) continue;
+            if (event->mask & IN_DELETE_SELF) {
+                watch_dirs_.erase(dir_it);
+                continue;
+            }
+            if (event->len == 0) continue;
+
+            std::string path = dir_it->second + "/" + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) addWatchRecursive(path);   // 新建的子目录也要监视
+            } else if (event->mask & FILE_EVENTS) {
+                changed.push_back(std::move(path));
+            }
+        }
+    }
+
+    // 同一文件在一帧内可能报告多次（如先写入再改名），只重载一次
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+void FileWatcher::addWatchRecursive(const std::string& dir)
+{
+    int wd = inotify_add_watch(fd_, dir.c_str(), FILE_EVENTS | DIR_EVENTS);
+    if (wd < 0) {
+        spdlog::warn("FileWatcher: 无法监视目录 '{}': {}", dir, std::strerror(errno));
+        return;
+    }
+    watch_dirs_[wd] = dir;
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.is_directory(ec)) addWatchRecursive(entry.path().generic_string());
+    }
+}
+
+#else
+
+FileWatcher::FileWatcher(std::string_view root_dir) : root_dir_(root_dir)
+{
+    spdlog::warn("FileWatcher: 当前平台不支持文件监视，资源热重载不可用。");
+}
+
+FileWatcher::~FileWatcher() = default;
+
+std::vector<std::string> FileWatcher::poll()
+{
+    return {};
+}
+
+void FileWatcher::addWatchRecursive(const std::string&)
+{
+}
+
+#endif
+
+} // namespace engine::debug
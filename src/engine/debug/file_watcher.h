@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::debug {
+
+/**
+ * @brief 调试用文件监视器：递归监视一个目录（如 assets），报告被修改的文件，用于资源热重载。
+ *
+ * Linux 上基于 inotify（非阻塞），每帧调用 poll() 取出变化，开销只是一次 read() 系统调用。
+ * 其它平台暂不支持，isActive() 返回 false，poll() 始终返回空。
+ * 只在调试构建中由 GameApp 创建。构造失败会抛出异常。
+ */
+class FileWatcher final {
+private:
+    std::string root_dir_;                                  ///< @brief 监视的根目录
+    int fd_ = -1;                                           ///< @brief inotify 文件描述符
+    std::unordered_map<int, std::string> watch_dirs_;       ///< @brief 监视描述符 -> 目录路径
+
+public:
+    /**
+     * @brief 构造函数，开始递归监视指定目录。
+     * @param root_dir 根目录（相对于工作目录，如 "assets"），报告的路径以它开头。
+     * @throws std::runtime_error 如果无法创建监视。
+     */
+    explicit FileWatcher(std::string_view root_dir);
+    ~FileWatcher();
+
+    // 禁止拷贝和移动
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher(FileWatcher&&) = delete;
+    FileWatcher& operator=(FileWatcher&&) = delete;
+
+    /**
+     * @brief 取出自上次调用以来写入完成的文件（非阻塞，已去重）。
+     * @return 文件路径列表，如 "assets/data/enemy_data.json"。
+     */
+    std::vector<std::string> poll();
+
+    bool isActive() const { return fd_ >= 0; }              ///< @brief 是否正在监视
+
+private:
+    void addWatchRecursive(const std::string& dir);         ///< @brief 监视目录及其所有子目录
+};
+
+} // namespace engine::debug
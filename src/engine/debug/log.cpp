@@ -0,0 +1,80 @@
+#include "log.h"
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+#include <spdlog/sinks/dup_filter_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <memory>
+#include <mutex>
+
+namespace engine::debug {
+
+namespace {
+/// @brief 调用点注册表（调用点本身是函数内静态变量，生命周期覆盖整个程序）
+struct LogSiteRegistry {
+    std::mutex mutex_;
+    std::vector<const LogSite*> sites_;
+};
+
+LogSiteRegistry& registry() {
+    static LogSiteRegistry instance;
+    return instance;
+}
+
+std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
+LogSite::LogSite(const char* file, int line) : file_(file), line_(line) {
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex_);
+    reg.sites_.push_back(this);
+}
+
+bool LogSite::shouldLog(std::chrono::milliseconds interval) {
+    calls_.fetch_add(1, std::memory_order_relaxed);
+    std::int64_t now = nowNs();
+    std::int64_t last = last_emit_ns_.load(std::memory_order_relaxed);
+
+    if (emitted_.load(std::memory_order_relaxed) > 0) {
+        if (interval.count() == 0) return false;    // 只输出一次
+        auto interval_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+        if (now - last < interval_ns) return false;
+    }
+    // 多线程同时到达时只让一个线程输出
+    if (!last_emit_ns_.compare_exchange_strong(last, now, std::memory_order_relaxed)) return false;
+    emitted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void initAsyncLogger(std::size_t queue_size, std::chrono::milliseconds dedup_interval) {
+    auto level = spdlog::get_level();   // 保留调用前设置的日志级别
+
+    spdlog::init_thread_pool(queue_size, 1);
+    auto dup_filter = std::make_shared<spdlog::sinks::dup_filter_sink_mt>(dedup_interval);
+    dup_filter->add_sink(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+
+    auto logger = std::make_shared<spdlog::async_logger>("engine", dup_filter, spdlog::thread_pool(),
+                                                         spdlog::async_overflow_policy::overrun_oldest);
+    logger->set_level(level);
+    logger->flush_on(spdlog::level::err);
+    spdlog::set_default_logger(logger);
+    spdlog::trace("异步日志器安装完成，队列容量: {}", queue_size);
+}
+
+void shutdownLogger() {
+    spdlog::shutdown();
+}
+
+void getLogSites(std::pmr::vector<const LogSite*>& sites) {
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex_);
+    sites.assign(reg.sites_.begin(), reg.sites_.end());
+}
+
+std::size_t getDroppedLogCount() {
+    auto pool = spdlog::thread_pool();
+    return pool ? pool->overrun_counter() : 0;
+}
+
+} // namespace engine::debug
@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace engine::debug {
+
+/**
+ * @brief 日志调用点：记录某一处节流日志被调用/实际输出的次数。
+ *
+ * 由 ENGINE_LOG_THROTTLED / ENGINE_LOG_ONCE 宏以函数内静态变量的形式创建，
+ * 首次构造时注册到全局列表，供调试面板显示各调用点的计数。
+ */
+class LogSite final {
+private:
+    const char* file_;                          ///< @brief 源文件 (__FILE__)
+    int line_;                                  ///< @brief 行号 (__LINE__)
+    std::atomic<std::uint64_t> calls_{0};       ///< @brief 调用次数
+    std::atomic<std::uint64_t> emitted_{0};     ///< @brief 实际输出次数
+    std::atomic<std::int64_t> last_emit_ns_{0}; ///< @brief 上次输出的时间 (steady_clock, 纳秒)
+
+public:
+    LogSite(const char* file, int line);
+
+    // 禁止拷贝和移动（注册表中保存的是地址）
+    LogSite(const LogSite&) = delete;
+    LogSite& operator=(const LogSite&) = delete;
+    LogSite(LogSite&&) = delete;
+    LogSite& operator=(LogSite&&) = delete;
+
+    /**
+     * @brief 记录一次调用，并判断是否允许输出。
+     * @param interval 两次输出之间的最小间隔；为 0 时只输出第一次。
+     * @return 允许输出时返回 true。
+     */
+    bool shouldLog(std::chrono::milliseconds interval);
+
+    const char* getFile() const { return file_; }                               ///< @brief 获取源文件
+    int getLine() const { return line_; }                                       ///< @brief 获取行号
+    std::uint64_t getCalls() const { return calls_.load(std::memory_order_relaxed); }       ///< @brief 获取调用次数
+    std::uint64_t getEmitted() const { return emitted_.load(std::memory_order_relaxed); }   ///< @brief 获取输出次数
+    std::uint64_t getSuppressed() const { return getCalls() - getEmitted(); }               ///< @brief 获取被抑制的次数
+};
+
+/**
+ * @brief 安装异步日志器作为 spdlog 默认日志器。
+ *
+ * 日志写入有界队列，由后台线程输出到控制台；队列满时丢弃最旧的消息而不是阻塞游戏线程。
+ * 控制台输出前经过去重 sink，在 dedup_interval 内连续重复的消息只输出一次。
+ * @param queue_size 队列容量（消息条数）。
+ * @param dedup_interval 重复消息的合并窗口。
+ */
+void initAsyncLogger(std::size_t queue_size = 8192, std::chrono::milliseconds dedup_interval = std::chrono::milliseconds(1000));
+
+void shutdownLogger();                          ///< @brief 刷新并关闭日志线程（程序退出前调用）
+
+void getLogSites(std::pmr::vector<const LogSite*>& sites);     ///< @brief 获取所有已注册调用点的快照（写入 sites，可使用帧内存池）
+std::size_t getDroppedLogCount();               ///< @brief 获取异步队列因溢出而丢弃的消息数量
+
+} // namespace engine::debug
+
+/**
+ * @brief 节流日志：同一调用点在 interval_ms 毫秒内最多输出一次，用于每帧都可能执行的代码路径。
+ * 用法：ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "纹理 '{}' 未找到", path);
+ */
+#define ENGINE_LOG_THROTTLED(level, interval_ms, ...)                                               \
+    do {                                                                                            \
+        static engine::debug::LogSite engine_log_site_(__FILE__, __LINE__);                         \
+        if (engine_log_site_.shouldLog(std::chrono::milliseconds(interval_ms))) {                   \
+            spdlog::log(level, __VA_ARGS__);                                                        \
+        }                                                                                           \
+    } while (0)
+
+/// @brief 同一调用点只输出一次（之后的调用只计数）
+#define ENGINE_LOG_ONCE(level, ...) ENGINE_LOG_THROTTLED(level, 0, __VA_ARGS__)
@@ -0,0 +1,31 @@
+#pragma once
+#include <SDL3/SDL_timer.h>     // 用于 SDL_GetPerformanceCounter
+
+namespace engine::debug {
+
+/**
+ * @brief 作用域计时器：构造时开始计时，析构时将经过的毫秒数写入目标变量。
+ *
+ * 用法：{ ScopedTimer timer(timings.update_ms_); scene_manager_->update(dt); }
+ */
+class ScopedTimer final {
+private:
+    float& out_ms_;         ///< @brief 计时结果写入的位置（毫秒）
+    Uint64 start_ = 0;      ///< @brief 开始时的性能计数器值
+
+public:
+    explicit ScopedTimer(float& out_ms) : out_ms_(out_ms), start_(SDL_GetPerformanceCounter()) {}
+
+    ~ScopedTimer() {
+        Uint64 elapsed = SDL_GetPerformanceCounter() - start_;
+        out_ms_ = static_cast<float>(static_cast<double>(elapsed) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()));
+    }
+
+    // 禁止拷贝和移动
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ScopedTimer(ScopedTimer&&) = delete;
+    ScopedTimer& operator=(ScopedTimer&&) = delete;
+};
+
+} // namespace engine::debug
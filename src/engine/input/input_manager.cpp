@@ -21,39 +21,69 @@ InputManager::InputManager(SDL_Renderer* sdl_renderer, const engine::core::Confi
 }
 
 entt::sink<entt::sigh<void()>> InputManager::onAction(std::string_view action_name, ActionState action_state) {
-    return actions_to_func_[std::string(action_name)].at(static_cast<size_t>(action_state));
+    return action_signals_[registerAction(action_name)].at(static_cast<size_t>(action_state));
+}
+
+ActionId InputManager::getActionId(std::string_view action_name) const {
+    auto it = action_ids_.find(action_name);
+    return it != action_ids_.end() ? it->second : INVALID_ACTION_ID;
+}
+
+ActionId InputManager::registerAction(std::string_view action_name) {
+    if (auto it = action_ids_.find(action_name); it != action_ids_.end()) return it->second;
+    if (action_states_.size() >= INVALID_ACTION_ID) {
+        throw std::runtime_error("输入管理器: 动作数量超出上限");
+    }
+    auto id = static_cast<ActionId>(action_states_.size());
+    action_ids_.emplace(action_name, id);
+    action_states_.push_back(ActionState::INACTIVE);
+    action_signals_.emplace_back();
+    return id;
 }
 
 // --- 更新和事件处理 ---
 
 void InputManager::update() {
-    // 1. 根据上一帧的值更新默认的动作状态
-    for (auto& [action_name, state] : action_states_) {
-        if (state == ActionState::PRESSED) {
-            state = ActionState::HELD;                 // 当某个键按下不动时，并不会生成SDL_Event。
-        } else if (state == ActionState::RELEASED) {
-            state = ActionState::INACTIVE;
+    // 1. 推进上一帧发生跳变的动作（只有它们的状态需要改变）
+    events_.clear();
+    consumed_events_ = 0;
+    const std::uint64_t frame_start_ns = SDL_GetTicksNS();
+    for (std::size_t i = 0; i < changed_actions_.size(); ++i) {
+        const ActionId id = changed_actions_[i];
+        if (action_states_[id] == ActionState::PRESSED) {
+            recordEvent(id, ActionState::HELD, frame_start_ns);     // 当某个键按下不动时，并不会生成SDL_Event。
+        } else if (action_states_[id] == ActionState::RELEASED) {
+            action_states_[id] = ActionState::INACTIVE;
         }
     }
+    changed_actions_.clear();
 
-    // 2. 处理所有待处理的 SDL 事件 (这将设定 action_states_ 的值)
+    // 2. 处理所有待处理的 SDL 事件 (这将设定 action_states_ 的值并记录跳变)
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         processEvent(event);
     }
 
-    // 3. 触发回调
-    for(auto& [action_name, state] : action_states_) {
-        if (state != ActionState::INACTIVE) {
-            if(auto it = actions_to_func_.find(action_name); it != actions_to_func_.end())
-            {
-                it->second.at(static_cast<size_t>(state)).publish();
-            }
-        }
+    // 3. 按事件顺序触发回调(唯一的触发点)，同一帧内的每次跳变都会触发（回调中可能注册新动作，因此按下标遍历）
+    for (std::size_t i = 0; i < events_.size(); ++i) {
+        publish(events_[i].action_id_, events_[i].state_);
+    }
+}
+
+std::span<const InputEvent> InputManager::consumeInputEvents(std::uint64_t until_ns) {
+    std::size_t begin = consumed_events_;
+    while (consumed_events_ < events_.size() && events_[consumed_events_].timestamp_ns_ <= until_ns) {
+        ++consumed_events_;
     }
+    return std::span<const InputEvent>(events_).subspan(begin, consumed_events_ - begin);
+}
+
+void InputManager::publish(ActionId action_id, ActionState action_state) {
+    action_signals_[action_id].at(static_cast<size_t>(action_state)).publish();
 }
 
 void InputManager::processEvent(const SDL_Event& event) {
+    event_signal_.publish(event);       // 先转发原始事件给订阅者（如调试面板）
     switch (event.type) {
         case SDL_EVENT_KEY_DOWN:
         case SDL_EVENT_KEY_UP: {
@@ -61,12 +91,8 @@ void InputManager::processEvent(const SDL_Event& event) {
             bool is_down = event.key.down; 
             bool is_repeat = event.key.repeat;
 
-            auto it = input_to_actions_.find(scancode);
-            if (it != input_to_actions_.end()) {     // 如果按键有对应的action
-                const std::vector<std::string>& associated_actions = it->second;
-                for (const auto& action_name : associated_actions) {
-                    updateActionState(action_name, is_down, is_repeat); // 更新action状态
-                }
+            if (scancode >= 0 && scancode < SDL_SCANCODE_COUNT) {     // 更新按键对应的action状态
+                updateActionStates(key_bindings_[scancode], is_down, is_repeat, event.key.timestamp);
             }
             break;
         }
@@ -74,16 +100,12 @@ void InputManager::processEvent(const SDL_Event& event) {
         case SDL_EVENT_MOUSE_BUTTON_UP: {
             Uint32 button = event.button.button;              // 获取鼠标按钮
             bool is_down = event.button.down;
-            auto it = input_to_actions_.find(button);
-            if (it != input_to_actions_.end()) {     // 如果鼠标按钮有对应的action
-                const std::vector<std::string>& associated_actions = it->second;
-                for (const auto& action_name : associated_actions) {
-                    // 鼠标事件不考虑repeat, 所以第三个参数传false
-                    updateActionState(action_name, is_down, false); // 更新action状态
-                }
-            }
-            // 在点击时更新鼠标位置
+            // 在点击时更新鼠标位置（先于记录事件，事件中保存点击位置）
             mouse_position_ = {event.button.x, event.button.y};
+            if (button < MOUSE_BUTTON_COUNT) {      // 更新鼠标按钮对应的action状态
+                // 鼠标事件不考虑repeat, 所以第三个参数传false
+                updateActionStates(mouse_bindings_[button], is_down, false, event.button.timestamp);
+            }
             break;
         }
         case SDL_EVENT_MOUSE_MOTION:        // 处理鼠标运动
@@ -99,28 +121,6 @@ void InputManager::processEvent(const SDL_Event& event) {
 
 // --- 状态查询方法 ---
 
-bool InputManager::isActionDown(std::string_view action_name) const {
-    // C++17 引入的 “带有初始化语句的 if 语句”
-    if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-        return it->second == ActionState::PRESSED || it->second == ActionState::HELD;
-    }
-    return false;
-}
-
-bool InputManager::isActionPressed(std::string_view action_name) const {
-    if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-        return it->second == ActionState::PRESSED;
-    }
-    return false;
-}
-
-bool InputManager::isActionReleased(std::string_view action_name) const {
-    if (auto it = action_states_.find(std::string(action_name)); it != action_states_.end()) {
-        return it->second == ActionState::RELEASED;
-    }
-    return false;
-}
-
 bool InputManager::shouldQuit() const {
     return should_quit_;
 }
@@ -136,10 +136,15 @@ glm::vec2 InputManager::getMousePosition() const
 }
 
 glm::vec2 InputManager::getLogicalMousePosition() const
+{
+    return toLogicalPosition(mouse_position_);
+}
+
+glm::vec2 InputManager::toLogicalPosition(const glm::vec2& screen_position) const
 {
     glm::vec2 logical_pos;
     // 通过窗口坐标获取渲染坐标（逻辑坐标）
-    SDL_RenderCoordinatesFromWindow(sdl_renderer_, mouse_position_.x, mouse_position_.y, &logical_pos.x, &logical_pos.y);
+    SDL_RenderCoordinatesFromWindow(sdl_renderer_, screen_position.x, screen_position.y, &logical_pos.x, &logical_pos.y);
     return logical_pos;
 }
 
@@ -152,8 +157,12 @@ void InputManager::initializeMappings(const engine::core::Config* config) {
         throw std::runtime_error("输入管理器: Config 为空指针");
     }
     auto actions_to_keyname = config->input_mappings_;      // 获取配置中的输入映射（动作 -> 按键名称）
-    input_to_actions_.clear();
-    action_states_.clear();
+    for (auto& actions : key_bindings_) actions.clear();
+    for (auto& actions : mouse_bindings_) actions.clear();
+    for (auto& state : action_states_) state = ActionState::INACTIVE;   // 已注册的动作(及其回调)保留
+    changed_actions_.clear();
+    events_.clear();
+    consumed_events_ = 0;
 
     // 如果配置中没有定义鼠标按钮动作(通常不需要配置),则添加默认映射, 用于 UI
     if (actions_to_keyname.find("mouse_left") == actions_to_keyname.end()) {
@@ -166,20 +175,20 @@ void InputManager::initializeMappings(const engine::core::Config* config) {
     }
     // 遍历 动作 -> 按键名称 的映射
     for (const auto& [action_name, key_names] : actions_to_keyname) {
-        // 每个动作对应一个动作状态，初始化为 INACTIVE
-        action_states_[action_name] = ActionState::INACTIVE;
-        spdlog::trace("映射动作: {}", action_name);
+        // 每个动作分配一个ID，状态初始化为 INACTIVE
+        ActionId action_id = registerAction(action_name);
+        spdlog::trace("映射动作: {} (ID: {})", action_name, action_id);
         // 设置 "按键 -> 动作" 的映射
         for (const auto& key_name : key_names) {
             SDL_Scancode scancode = scancodeFromString(key_name);       // 尝试根据按键名称获取scancode
             Uint32 mouse_button = mouseButtonFromString(key_name);  // 尝试根据按键名称获取鼠标按钮
             // 未来可添加其它输入类型 ...
 
-            if (scancode != SDL_SCANCODE_UNKNOWN) {      // 如果scancode有效,则将action添加到scancode_to_actions_map_中
-                input_to_actions_[scancode].push_back(action_name);     
+            if (scancode != SDL_SCANCODE_UNKNOWN) {      // 如果scancode有效,则将action添加到按键绑定表中
+                key_bindings_[scancode].push_back(action_id);
                 spdlog::trace("  映射按键: {} (Scancode: {}) 到动作: {}", key_name, static_cast<int>(scancode), action_name);
-            } else if (mouse_button != 0) {             // 如果鼠标按钮有效,则将action添加到mouse_button_to_actions_map_中
-                input_to_actions_[mouse_button].push_back(action_name); 
+            } else if (mouse_button != 0) {             // 如果鼠标按钮有效,则将action添加到鼠标按钮绑定表中
+                mouse_bindings_[mouse_button].push_back(action_id);
                 spdlog::trace("  映射鼠标按钮: {} (Button ID: {}) 到动作: {}", key_name, static_cast<int>(mouse_button), action_name);
                 // else if: 未来可添加其它输入类型 ...
             } else {
@@ -207,22 +216,28 @@ Uint32 InputManager::mouseButtonFromString(std::string_view button_name) {
     return 0; // 0 不是有效的按钮值，表示无效
 }
 
-void InputManager::updateActionState(std::string_view action_name, bool is_input_active, bool is_repeat_event) {
-    auto it = action_states_.find(std::string(action_name));
-    if (it == action_states_.end()) {
-        spdlog::warn("尝试更新未注册的动作状态: {}", action_name);
-        return;
-    }
-
-    if (is_input_active) { // 输入被激活 (按下)
-        if (is_repeat_event) {
-            it->second = ActionState::HELD; 
-        } else {            // 非重复的按下事件
-            it->second = ActionState::PRESSED;
+void InputManager::updateActionStates(const std::vector<ActionId>& action_ids, bool is_input_active, bool is_repeat_event,
+                                      std::uint64_t timestamp_ns) {
+    for (ActionId id : action_ids) {
+        const auto state = action_states_[id];
+        if (is_input_active && is_repeat_event) {
+            // 重复事件不是新的按下，只确保处于持续按下状态：本帧刚按下的动作下一帧自然进入 HELD，
+            // 没有收到按下的(例如窗口获得焦点时键已按住)才在这里进入
+            if (state == ActionState::INACTIVE || state == ActionState::RELEASED) {
+                recordEvent(id, ActionState::HELD, timestamp_ns);
+            }
+            continue;
         }
-    } else { // 输入被释放 (松开)
-        it->second = ActionState::RELEASED;
+
+        // 输入被激活 (按下) 或被释放 (松开)：记录跳变，下一帧再推进为 HELD/INACTIVE
+        recordEvent(id, is_input_active ? ActionState::PRESSED : ActionState::RELEASED, timestamp_ns);
+        changed_actions_.push_back(id);
     }
 }
 
+void InputManager::recordEvent(ActionId action_id, ActionState action_state, std::uint64_t timestamp_ns) {
+    action_states_[action_id] = action_state;
+    events_.push_back({action_id, action_state, timestamp_ns, mouse_position_});
+}
+
 } // namespace engine::input 
\ No newline at end of file
@@ -1,13 +1,19 @@
 #pragma once
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
-#include <variant>
 #include <SDL3/SDL_render.h>
+#include <SDL3/SDL_scancode.h>
+#include <SDL3/SDL_mouse.h>
 #include <glm/vec2.hpp>
 #include <entt/signal/sigh.hpp>
 #include <array>
+#include "../utils/string_hash.h"
 
 namespace engine::core {
     class Config;
@@ -22,19 +28,51 @@ enum class ActionState {
     INACTIVE           ///< @brief 动作未激活
 };
 
+using ActionId = std::uint16_t;                                                     ///< @brief 动作ID(加载配置时按名称分配的连续整数)
+inline constexpr ActionId INVALID_ACTION_ID = std::numeric_limits<ActionId>::max(); ///< @brief 无效的动作ID
+
+/**
+ * @brief 一次动作状态的跳变(按下、释放或进入持续按下)，按发生的先后顺序记录。
+ *
+ * 同一帧内的多次点击会产生多条记录，不会像动作状态那样被合并。
+ */
+struct InputEvent {
+    ActionId action_id_ = INVALID_ACTION_ID;    ///< @brief 动作ID
+    ActionState state_ = ActionState::PRESSED;  ///< @brief 跳变后的状态(PRESSED、RELEASED 或 HELD)
+    std::uint64_t timestamp_ns_ = 0;            ///< @brief SDL 事件时间戳(纳秒，与 SDL_GetTicksNS 同一时基)
+    glm::vec2 mouse_position_ = {0.0f, 0.0f};   ///< @brief 事件发生时的鼠标位置(屏幕坐标)
+};
+
 /**
  * @brief 输入管理器类，负责处理输入事件和动作状态。
  * 
  * 该类管理输入事件，将按键转换为动作状态，并提供查询动作状态的功能。
  * 它还处理鼠标位置的逻辑坐标转换。
+ *
+ * 动作名称在加载配置时被分配为连续的 ActionId，状态与回调保存在以 ID 为下标的数组中，
+ * 按键/鼠标按钮到动作的绑定也是数组。查询时可以直接使用 ID(一次数组访问)，
+ * 按名称查询只做一次免分配的哈希查找。
+ *
+ * 每次状态跳变都会记录到本帧的输入事件队列(带时间戳)，回调只在处理完本帧的 SDL 事件后
+ * 按队列顺序统一触发：PRESSED/RELEASED 每次按下/释放各一次，HELD 只在进入持续按下状态时一次
+ * (上一帧按下、或只收到按键重复事件时)。没有输入的帧不做任何工作。
  */
 class InputManager final {
 private:
     SDL_Renderer* sdl_renderer_;                                            ///< @brief 用于获取逻辑坐标的 SDL_Renderer 指针
-    std::unordered_map<std::string, std::array<entt::sigh<void()>, 3>> actions_to_func_;      ///< @brief 存储动作名称到按键名称列表的映射
-    std::unordered_map<std::variant<SDL_Scancode, Uint32>, std::vector<std::string>> input_to_actions_;///< @brief 从输入到关联的动作名称列表
+    static constexpr std::size_t MOUSE_BUTTON_COUNT = SDL_BUTTON_X2 + 1;   ///< @brief 鼠标按钮绑定表的大小
+
+    std::unordered_map<std::string, ActionId, engine::utils::StringHash, std::equal_to<>> action_ids_;  ///< @brief 动作名称 -> 动作ID
+    std::vector<ActionState> action_states_;                        ///< @brief 动作ID -> 当前状态
+    std::deque<std::array<entt::sigh<void()>, 3>> action_signals_;  ///< @brief 动作ID -> 各状态的回调(deque 保证新增动作时已有信号的地址不变)
+    std::vector<ActionId> changed_actions_;                         ///< @brief 本帧变为 PRESSED/RELEASED 的动作，下一帧推进为 HELD/INACTIVE
+    std::vector<InputEvent> events_;                                ///< @brief 本帧的输入事件(按时间顺序)
+    std::size_t consumed_events_ = 0;                               ///< @brief consumeInputEvents 已取走的事件数
 
-    std::unordered_map<std::string, ActionState> action_states_;    ///< @brief 存储每个动作的当前状态
+    std::array<std::vector<ActionId>, SDL_SCANCODE_COUNT> key_bindings_;    ///< @brief Scancode -> 关联的动作ID
+    std::array<std::vector<ActionId>, MOUSE_BUTTON_COUNT> mouse_bindings_;  ///< @brief 鼠标按钮 -> 关联的动作ID
+
+    entt::sigh<void(const SDL_Event&)> event_signal_;               ///< @brief 原始 SDL 事件信号（供 ImGui 等需要原始事件的模块订阅）
 
     bool should_quit_ = false;                                      ///< @brief 退出标志
     glm::vec2 mouse_position_;                                      ///< @brief 鼠标位置 (针对屏幕坐标)
@@ -48,27 +86,59 @@ public:
      */
     InputManager(SDL_Renderer* sdl_renderer, const engine::core::Config* config);
 
+    /**
+     * @brief 获取动作的回调接口(动作未在配置中定义时会注册一个没有绑定的新动作)
+     */
     entt::sink<entt::sigh<void()>> onAction(std::string_view action_name, ActionState action_state = ActionState::PRESSED);
+    entt::sink<entt::sigh<void(const SDL_Event&)>> onEvent() { return event_signal_; }  ///< @brief 订阅原始 SDL 事件
 
     void update();                                    ///< @brief 更新输入状态，每轮循环最先调用
 
 
+    ActionId getActionId(std::string_view action_name) const;     ///< @brief 获取动作ID，未定义时返回 INVALID_ACTION_ID
+    ActionState getActionState(ActionId action_id) const {        ///< @brief 获取动作状态(无效ID视为 INACTIVE)
+        return action_id < action_states_.size() ? action_states_[action_id] : ActionState::INACTIVE;
+    }
+
     // 动作状态检查
-    bool isActionDown(std::string_view action_name) const;        ///< @brief 动作当前是否触发 (持续按下或本帧按下)
-    bool isActionPressed(std::string_view action_name) const;     ///< @brief 动作是否在本帧刚刚按下
-    bool isActionReleased(std::string_view action_name) const;    ///< @brief 动作是否在本帧刚刚释放
+    bool isActionDown(ActionId action_id) const {                 ///< @brief 动作当前是否触发 (持续按下或本帧按下)
+        auto state = getActionState(action_id);
+        return state == ActionState::PRESSED || state == ActionState::HELD;
+    }
+    bool isActionPressed(ActionId action_id) const { return getActionState(action_id) == ActionState::PRESSED; }    ///< @brief 动作是否在本帧刚刚按下
+    bool isActionReleased(ActionId action_id) const { return getActionState(action_id) == ActionState::RELEASED; }  ///< @brief 动作是否在本帧刚刚释放
+    bool isActionDown(std::string_view action_name) const { return isActionDown(getActionId(action_name)); }          ///< @brief 同上，按名称查询
+    bool isActionPressed(std::string_view action_name) const { return isActionPressed(getActionId(action_name)); }    ///< @brief 同上，按名称查询
+    bool isActionReleased(std::string_view action_name) const { return isActionReleased(getActionId(action_name)); }  ///< @brief 同上，按名称查询
+
+    // 输入事件队列
+    std::span<const InputEvent> getInputEvents() const { return events_; }     ///< @brief 本帧的全部输入事件(按时间顺序)
+    /**
+     * @brief 按时间取走本帧中尚未取走、且时间戳不晚于 until_ns 的事件。
+     *
+     * 供以固定步长推进的逻辑使用：每一步传入该步的结束时间，事件就会落在正确的步中。
+     * 本帧结束时仍未取走的事件会在下一次 update() 时丢弃。
+     * @param until_ns 截止时间(纳秒，SDL_GetTicksNS 时基)
+     * @return 取走的事件
+     */
+    std::span<const InputEvent> consumeInputEvents(std::uint64_t until_ns);
 
     bool shouldQuit() const;                                         ///< @brief 查询退出状态
     void setShouldQuit(bool should_quit);                            ///< @brief 设置退出状态
 
     glm::vec2 getMousePosition() const;                              ///< @brief 获取鼠标位置 （屏幕坐标）
     glm::vec2 getLogicalMousePosition() const;                       ///< @brief 获取鼠标位置 （逻辑坐标）
+    glm::vec2 toLogicalPosition(const glm::vec2& screen_position) const;    ///< @brief 屏幕坐标转换为逻辑坐标（如 InputEvent 中的鼠标位置）
 
 private:
     void processEvent(const SDL_Event& event);                      ///< @brief 处理 SDL 事件（将按键转换为动作状态）
     void initializeMappings(const engine::core::Config* config);                            ///< @brief 根据 Config配置初始化映射表
 
-    void updateActionState(std::string_view action_name, bool is_input_active, bool is_repeat_event); ///< @brief 辅助更新动作状态
+    ActionId registerAction(std::string_view action_name);          ///< @brief 获取动作ID，不存在时分配新的ID
+    void updateActionStates(const std::vector<ActionId>& action_ids, bool is_input_active, bool is_repeat_event,
+                            std::uint64_t timestamp_ns);    ///< @brief 辅助更新一组动作的状态，并记录跳变
+    void recordEvent(ActionId action_id, ActionState action_state, std::uint64_t timestamp_ns);  ///< @brief 设置动作状态并加入事件队列
+    void publish(ActionId action_id, ActionState action_state);     ///< @brief 触发动作在指定状态下的回调
     SDL_Scancode scancodeFromString(std::string_view key_name);                           ///< @brief 将字符串键名转换为 SDL_Scancode
     Uint32 mouseButtonFromString(std::string_view button_name);                       ///< @brief 将字符串按钮名转换为 SDL_Button
 };
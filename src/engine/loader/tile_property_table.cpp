@@ -0,0 +1,65 @@
+#include "tile_property_table.h"
+#include <algorithm>
+#include <nlohmann/json.hpp>
+#include <entt/core/hashed_string.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::loader {
+
+TilePropertyTable::TilePropertyTable() {
+    clear();
+}
+
+void TilePropertyTable::clear() {
+    properties_.clear();
+    sets_.clear();
+    sets_.emplace_back(0, 0);   // EMPTY
+}
+
+TilePropertyTable::Index TilePropertyTable::intern(const nlohmann::json& properties_json) {
+    if (!properties_json.is_array() || properties_json.empty()) return EMPTY;
+
+    const auto begin = static_cast<std::uint32_t>(properties_.size());
+    for (const auto& property : properties_json) {
+        if (!property.contains("name") || !property["name"].is_string() || !property.contains("value")) continue;
+        const auto name = property["name"].get<std::string>();
+        const auto& value = property["value"];
+
+        // 优先按 Tiled 声明的类型转换，没有声明时按json值的类型
+        const std::string type = property.value("type", "");
+        Value typed;
+        if (type == "bool" || (type.empty() && value.is_boolean())) {
+            typed = value.get<bool>();
+        } else if (type == "int" || type == "object" || (type.empty() && value.is_number_integer())) {
+            typed = value.get<int>();
+        } else if (type == "float" || (type.empty() && value.is_number())) {
+            typed = value.get<float>();
+        } else if (value.is_string()) {
+            typed = value.get<std::string>();   // string、color、file
+        } else {
+            spdlog::warn("瓦片属性 '{}' 的类型 '{}' 不受支持，已忽略。", name, type);
+            continue;
+        }
+        properties_.push_back({entt::hashed_string::value(name.data(), name.size()), std::move(typed)});
+    }
+    const auto end = static_cast<std::uint32_t>(properties_.size());
+    if (begin == end) return EMPTY;
+
+    // 属性集内按名称哈希排序，供二分查找
+    std::sort(properties_.begin() + begin, properties_.end(),
+              [](const Property& a, const Property& b) { return a.name_id_ < b.name_id_; });
+    sets_.emplace_back(begin, end);
+    return static_cast<Index>(sets_.size() - 1);
+}
+
+const TilePropertyTable::Value* TilePropertyTable::find(Index index, entt::id_type name_id) const {
+    if (index >= sets_.size()) return nullptr;
+    const auto [begin, end] = sets_[index];
+    auto first = properties_.begin() + begin;
+    auto last = properties_.begin() + end;
+    auto it = std::lower_bound(first, last, name_id,
+                               [](const Property& property, entt::id_type id) { return property.name_id_ < id; });
+    return (it != last && it->name_id_ == name_id) ? &it->value_ : nullptr;
+}
+
+} // namespace engine::loader
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+#include <entt/core/fwd.hpp>
+
+namespace engine::loader {
+
+/**
+ * @brief 瓦片自定义属性表：把图块集中每个瓦片的 Tiled 属性数组转换为紧凑的类型化数据，按索引共享。
+ *
+ * 所有属性连续存放在一个数组中，每个属性集是其中按名称哈希排序的一段，
+ * 同一个图块瓦片的所有实例只保存一个索引，查询时对这一段做二分查找，不再遍历json。
+ */
+class TilePropertyTable final {
+public:
+    using Index = std::uint32_t;
+    using Value = std::variant<bool, int, float, std::string>;  ///< @brief bool/int/float/string（color、file 按字符串保存，object 按 int 保存）
+
+    static constexpr Index EMPTY = 0;       ///< @brief 空属性集（没有任何属性的瓦片）
+
+private:
+    struct Property {
+        entt::id_type name_id_;     ///< @brief 属性名称的哈希值
+        Value value_;               ///< @brief 属性值
+    };
+
+    std::vector<Property> properties_;                          ///< @brief 所有属性，每个属性集内按 name_id_ 升序
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> sets_; ///< @brief 索引 -> 属性集在 properties_ 中的范围 [begin, end)
+
+public:
+    TilePropertyTable();
+
+    TilePropertyTable(const TilePropertyTable&) = delete;
+    TilePropertyTable& operator=(const TilePropertyTable&) = delete;
+    TilePropertyTable(TilePropertyTable&&) = delete;
+    TilePropertyTable& operator=(TilePropertyTable&&) = delete;
+
+    /**
+     * @brief 添加一个属性集
+     * @param properties_json Tiled 瓦片的 "properties" 数组
+     * @return 属性集索引；数组为空或无效时返回 EMPTY
+     */
+    Index intern(const nlohmann::json& properties_json);
+
+    /**
+     * @brief 查询属性值（二分查找）
+     * @tparam T 属性类型，数值类型之间允许转换 (int <-> float)
+     * @param index 属性集索引
+     * @param name_id 属性名称的哈希值
+     * @return 属性值，如果属性不存在或类型不匹配则返回 std::nullopt
+     */
+    template<typename T>
+    std::optional<T> get(Index index, entt::id_type name_id) const {
+        const Value* value = find(index, name_id);
+        if (!value) return std::nullopt;
+        if (const T* exact = std::get_if<T>(value)) return *exact;
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            if (const int* i = std::get_if<int>(value)) return static_cast<T>(*i);
+            if (const float* f = std::get_if<float>(value)) return static_cast<T>(*f);
+        }
+        return std::nullopt;
+    }
+
+    bool contains(Index index, entt::id_type name_id) const { return find(index, name_id) != nullptr; }  ///< @brief 属性是否存在
+
+    void clear();                                                       ///< @brief 清空（只保留 EMPTY）
+    std::size_t getSetCount() const { return sets_.size(); }           ///< @brief 属性集数量（含 EMPTY）
+    std::size_t getPropertyCount() const { return properties_.size(); } ///< @brief 属性总数
+
+private:
+    const Value* find(Index index, entt::id_type name_id) const;    ///< @brief 查找属性值，不存在返回 nullptr
+};
+
+} // namespace engine::loader
@@ -44,6 +44,9 @@ public:
     void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置是否需要删除
     bool isNeedRemove() const { return need_remove_; }                      ///< @brief 获取是否需要删除
 
+    /// @brief 获取组件容器（只读，供调试统计使用）
+    const std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>>& getComponents() const { return components_; }
+
     /**
      * @brief 添加组件 (里面会完成组件的init())
      * 
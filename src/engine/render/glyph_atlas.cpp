@@ -0,0 +1,103 @@
+#include "glyph_atlas.h"
+#include "../debug/log.h"
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace engine::render {
+
+namespace {
+constexpr int GLYPH_PADDING = 1;    ///< @brief 字形之间的间隔，避免采样时相互渗色
+}
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font, int width, int height)
+    : renderer_(renderer), font_(font), width_(width), height_(height)
+{
+    if (!renderer_ || !font_) {
+        throw std::runtime_error("GlyphAtlas 构造失败: SDL_Renderer 或 TTF_Font 为空指针。");
+    }
+
+    texture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width_, height_);
+    if (!texture_) {
+        throw std::runtime_error("GlyphAtlas 构造失败: 无法创建图集纹理: " + std::string(SDL_GetError()));
+    }
+    SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_NEAREST);     // 像素字体必须使用最邻近采样
+
+    // 初始化为全透明
+    std::vector<Uint32> clear_pixels(static_cast<std::size_t>(width_) * height_, 0);
+    SDL_UpdateTexture(texture_, nullptr, clear_pixels.data(), width_ * static_cast<int>(sizeof(Uint32)));
+
+    line_height_ = TTF_GetFontHeight(font_);
+    spdlog::trace("GlyphAtlas 构造成功 ({}x{}，行高 {})。", width_, height_, line_height_);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+        texture_ = nullptr;
+    }
+}
+
+const Glyph* GlyphAtlas::getGlyph(Uint32 codepoint)
+{
+    if (auto it = glyphs_.find(codepoint); it != glyphs_.end()) {
+        return &it->second;
+    }
+    if (full_) return nullptr;
+
+    int min_x = 0, max_x = 0, min_y = 0, max_y = 0, advance = 0;
+    if (!TTF_GetGlyphMetrics(font_, codepoint, &min_x, &max_x, &min_y, &max_y, &advance)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "GlyphAtlas: 字体中不存在字形 U+{:04X}", codepoint);
+        return nullptr;
+    }
+
+    SDL_Surface* rendered = TTF_RenderGlyph_Solid(font_, codepoint, SDL_Color{255, 255, 255, 255});
+    if (!rendered) {        // 空白字符等无法光栅化的字形只记录步进，不占用图集空间
+        auto [it, inserted] = glyphs_.emplace(codepoint, Glyph{SDL_FRect{0, 0, 0, 0}, static_cast<float>(advance)});
+        return &it->second;
+    }
+    SDL_Surface* surface = SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(rendered);
+    if (!surface) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "GlyphAtlas: 转换字形表面失败: {}", SDL_GetError());
+        return nullptr;
+    }
+
+    // 行打包：当前行放不下则换行，换行后仍放不下则图集已满
+    if (cursor_x_ + surface->w > width_) {
+        cursor_x_ = 0;
+        cursor_y_ += row_height_ + GLYPH_PADDING;
+        row_height_ = 0;
+    }
+    if (cursor_y_ + surface->h > height_) {
+        full_ = true;
+        spdlog::warn("GlyphAtlas: 图集已满 ({} 个字形)，后续新字形将被跳过。", glyphs_.size());
+        SDL_DestroySurface(surface);
+        return nullptr;
+    }
+
+    SDL_Rect dest = {cursor_x_, cursor_y_, surface->w, surface->h};
+    if (!SDL_UpdateTexture(texture_, &dest, surface->pixels, surface->pitch)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "GlyphAtlas: 更新图集纹理失败: {}", SDL_GetError());
+        SDL_DestroySurface(surface);
+        return nullptr;
+    }
+
+    cursor_x_ += surface->w + GLYPH_PADDING;
+    row_height_ = surface->h > row_height_ ? surface->h : row_height_;
+
+    Glyph glyph{SDL_FRect{static_cast<float>(dest.x), static_cast<float>(dest.y),
+                          static_cast<float>(dest.w), static_cast<float>(dest.h)},
+                static_cast<float>(advance)};
+    SDL_DestroySurface(surface);
+
+    auto [it, inserted] = glyphs_.emplace(codepoint, glyph);
+    return &it->second;
+}
+
+} // namespace engine::render
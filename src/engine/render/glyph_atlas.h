@@ -0,0 +1,75 @@
+#pragma once
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_stdinc.h>
+#include <cstddef>
+#include <unordered_map>
+
+struct SDL_Renderer;
+struct SDL_Texture;
+struct TTF_Font;
+
+namespace engine::render {
+
+/**
+ * @brief 单个字形在图集中的信息
+ */
+struct Glyph {
+    SDL_FRect src_rect_;    ///< @brief 图集中的源矩形（像素）
+    float advance_;         ///< @brief 水平步进（像素）
+};
+
+/**
+ * @brief 字形图集：按需将某一字体（固定大小）的字形光栅化到一张纹理中。
+ *
+ * 适用于像素字体 (如 VonwaonBitmap-16px)：字形使用 Solid 模式渲染、最邻近采样，保持像素清晰。
+ * 中日韩文字等任意 Unicode 字形在第一次使用时才写入图集，使用简单的行(shelf)打包。
+ * 图集满后新的字形将被跳过并输出警告。构造失败会抛出异常。
+ */
+class GlyphAtlas final {
+private:
+    SDL_Renderer* renderer_ = nullptr;              ///< @brief 渲染器的非拥有指针
+    TTF_Font* font_ = nullptr;                      ///< @brief 字体的非拥有指针（由 ResourceManager 持有）
+    SDL_Texture* texture_ = nullptr;                ///< @brief 图集纹理（拥有）
+    int width_ = 0;                                 ///< @brief 图集宽度
+    int height_ = 0;                                ///< @brief 图集高度
+    int line_height_ = 0;                           ///< @brief 字体行高
+
+    // 行打包游标
+    int cursor_x_ = 0;                              ///< @brief 当前行的下一个写入位置 x
+    int cursor_y_ = 0;                              ///< @brief 当前行的顶部 y
+    int row_height_ = 0;                            ///< @brief 当前行的最大高度
+    bool full_ = false;                             ///< @brief 图集是否已满
+
+    std::unordered_map<Uint32, Glyph> glyphs_;      ///< @brief 码点 -> 字形
+
+public:
+    /**
+     * @brief 构造函数
+     * @param renderer 有效的 SDL_Renderer 指针
+     * @param font 有效的 TTF_Font 指针
+     * @param width 图集宽度
+     * @param height 图集高度
+     * @throws std::runtime_error 如果指针为空或纹理创建失败
+     */
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font, int width = 1024, int height = 1024);
+    ~GlyphAtlas();
+
+    // 禁止拷贝和移动
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+    GlyphAtlas(GlyphAtlas&&) = delete;
+    GlyphAtlas& operator=(GlyphAtlas&&) = delete;
+
+    /**
+     * @brief 获取字形，未缓存时光栅化并写入图集
+     * @param codepoint Unicode 码点
+     * @return 字形指针；无法光栅化或图集已满时返回 nullptr
+     */
+    const Glyph* getGlyph(Uint32 codepoint);
+
+    SDL_Texture* getTexture() const { return texture_; }            ///< @brief 获取图集纹理
+    int getLineHeight() const { return line_height_; }              ///< @brief 获取行高
+    std::size_t getGlyphCount() const { return glyphs_.size(); }    ///< @brief 获取已缓存的字形数量
+};
+
+} // namespace engine::render
@@ -2,6 +2,8 @@
 #include "../resource/resource_manager.h"
 #include "camera.h"
 #include "sprite.h"
+#include "ui_draw_list.h"
+#include "../debug/log.h"
 #include <SDL3/SDL.h>
 #include <stdexcept> // For std::runtime_error
 #include <spdlog/spdlog.h>
@@ -27,13 +29,13 @@ Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager
 void Renderer::drawSprite(const Camera& camera, const Sprite& sprite, const glm::vec2& position, const glm::vec2& scale, double angle) {
     auto texture = resource_manager_->getTexture(sprite.getTextureId());
     if (!texture) {
-        spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法为 ID {} 获取纹理。", sprite.getTextureId());
         return;
     }
 
     auto src_rect = getSpriteSrcRect(sprite);
     if (!src_rect.has_value()) {
-        spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
         return;
     }
 
@@ -56,8 +58,9 @@ void Renderer::drawSprite(const Camera& camera, const Sprite& sprite, const glm:
     }
 
     // 执行绘制(默认旋转中心为精灵的中心点)
+    countDrawCall(texture);
     if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, angle, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("渲染旋转纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "渲染旋转纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
     }   
 }
 
@@ -65,13 +68,13 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
 {
     auto texture = resource_manager_->getTexture(sprite.getTextureId());
     if (!texture) {
-        spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法为 ID {} 获取纹理。", sprite.getTextureId());
         return;
     }
 
     auto src_rect = getSpriteSrcRect(sprite);
     if (!src_rect.has_value()) {
-        spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
         return;
     }
 
@@ -104,8 +107,9 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
     for (float y = start.y; y < stop.y; y += scaled_tex_h) {
         for (float x = start.x; x < stop.x; x += scaled_tex_w) {
             SDL_FRect dest_rect = {x, y, scaled_tex_w, scaled_tex_h};
+            countDrawCall(texture);
             if (!SDL_RenderTexture(renderer_, texture, nullptr, &dest_rect)) {
-                spdlog::error("渲染视差纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
+                ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "渲染视差纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
                 return;
             }
         }
@@ -115,13 +119,13 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
 void Renderer::drawUISprite(const Sprite& sprite, const glm::vec2& position, const std::optional<glm::vec2>& size) {
     auto texture = resource_manager_->getTexture(sprite.getTextureId());
     if (!texture) {
-        spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法为 ID {} 获取纹理。", sprite.getTextureId());
         return;
     }
 
     auto src_rect = getSpriteSrcRect(sprite);
     if (!src_rect.has_value()) {
-        spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
         return;
     }
 
@@ -135,37 +139,86 @@ void Renderer::drawUISprite(const Sprite& sprite, const glm::vec2& position, con
     }
 
     // 执行绘制(未考虑UI旋转)
+    countDrawCall(texture);
     if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "渲染 UI Sprite 失败 (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
     }
 }
 
 void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
     if (!SDL_SetRenderDrawColor(renderer_, r, g, b, a)) {
-        spdlog::error("设置渲染绘制颜色失败：{}", SDL_GetError());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "设置渲染绘制颜色失败：{}", SDL_GetError());
     }
 }
 
 void Renderer::setDrawColorFloat(float r, float g, float b, float a)
 {
     if (!SDL_SetRenderDrawColorFloat(renderer_, r, g, b, a)) {
-        spdlog::error("设置渲染绘制颜色失败：{}", SDL_GetError());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "设置渲染绘制颜色失败：{}", SDL_GetError());
     }
 }
 
 void Renderer::clearScreen() {
     if (!SDL_RenderClear(renderer_)) {
-        spdlog::error("清除渲染器失败：{}", SDL_GetError());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "清除渲染器失败：{}", SDL_GetError());
     }
 }
 
 void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color)
 {
-    setDrawColorFloat(color.r, color.g, color.b, color.a);
-    if (!SDL_RenderFillRect(renderer_, reinterpret_cast<const SDL_FRect*>(&rect))) {
-        spdlog::error("绘制填充矩形失败：{}", SDL_GetError());
+    // 颜色写入顶点，不需要设置再恢复渲染器的绘制颜色
+    const SDL_FColor fcolor = {color.r, color.g, color.b, color.a};
+    const float x0 = rect.position.x, y0 = rect.position.y;
+    const float x1 = x0 + rect.size.x, y1 = y0 + rect.size.y;
+    const SDL_Vertex vertices[4] = {
+        {{x0, y0}, fcolor, {0.0f, 0.0f}}, {{x1, y0}, fcolor, {0.0f, 0.0f}},
+        {{x1, y1}, fcolor, {0.0f, 0.0f}}, {{x0, y1}, fcolor, {0.0f, 0.0f}},
+    };
+    static constexpr int INDICES[6] = {0, 1, 2, 0, 2, 3};
+    countDrawCall(nullptr);
+    if (!SDL_RenderGeometry(renderer_, nullptr, vertices, 4, INDICES, 6)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "绘制填充矩形失败：{}", SDL_GetError());
+    }
+}
+
+void Renderer::recordUISprite(UIDrawList& draw_list, const Sprite& sprite, const glm::vec2& position,
+                              const std::optional<glm::vec2>& size)
+{
+    auto src_rect = getSpriteSrcRect(sprite);
+    if (!src_rect.has_value()) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+        return;
+    }
+    glm::vec2 texture_size = resource_manager_->getTextureSize(sprite.getTextureId());
+    if (texture_size.x <= 0.0f || texture_size.y <= 0.0f) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取纹理尺寸，ID: {}", sprite.getTextureId());
+        return;
+    }
+
+    // 源矩形换算为归一化纹理坐标
+    const auto& src = src_rect.value();
+    engine::utils::Rect uv_rect = {{src.x / texture_size.x, src.y / texture_size.y},
+                                   {src.w / texture_size.x, src.h / texture_size.y}};
+    engine::utils::Rect dest_rect = {position, size.value_or(glm::vec2(src.w, src.h))};
+    draw_list.addTexturedRect(sprite.getTextureId(), uv_rect, dest_rect, sprite.isFlipped());
+}
+
+void Renderer::drawUIGeometry(std::string_view texture_id, const SDL_Vertex* vertices, int num_vertices,
+                              const int* indices, int num_indices)
+{
+    SDL_Texture* texture = nullptr;
+    if (!texture_id.empty()) {
+        texture = resource_manager_->getTexture(texture_id);
+        if (!texture) {
+            ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法为 ID {} 获取纹理。", texture_id);
+            return;
+        }
+    }
+
+    countDrawCall(texture);
+    if (!SDL_RenderGeometry(renderer_, texture, vertices, num_vertices, indices, num_indices)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "绘制UI几何批次失败：{}", SDL_GetError());
     }
-    setDrawColorFloat(0, 0, 0, 1.0f);
 }
 
 void Renderer::present()
@@ -173,25 +226,40 @@ void Renderer::present()
     SDL_RenderPresent(renderer_);
 }
 
+void Renderer::resetStats()
+{
+    stats_ = RenderStats{};
+    last_texture_ = nullptr;
+}
+
+void Renderer::countDrawCall(SDL_Texture* texture)
+{
+    ++stats_.draw_calls_;
+    if (stats_.batches_ == 0 || texture != last_texture_) {
+        ++stats_.batches_;
+        last_texture_ = texture;
+    }
+}
+
 std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite)
 {
     SDL_Texture* texture = resource_manager_->getTexture(sprite.getTextureId());
     if (!texture) {
-        spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法为 ID {} 获取纹理。", sprite.getTextureId());
         return std::nullopt;
     }
 
     auto src_rect = sprite.getSourceRect();
     if (src_rect.has_value()) {     // 如果Sprite中存在指定rect，则判断尺寸是否有效
         if (src_rect.value().w <= 0 || src_rect.value().h <= 0) {
-            spdlog::error("源矩形尺寸无效，ID: {}", sprite.getTextureId());
+            ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "源矩形尺寸无效，ID: {}", sprite.getTextureId());
             return std::nullopt;
         }
         return src_rect;
     } else {                        // 否则获取纹理尺寸并返回整个纹理大小
         SDL_FRect result = {0, 0, 0, 0};
         if (!SDL_GetTextureSize(texture, &result.w, &result.h)) {
-            spdlog::error("无法获取纹理尺寸，ID: {}", sprite.getTextureId());
+            ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "无法获取纹理尺寸，ID: {}", sprite.getTextureId());
             return std::nullopt;
         }
         return result;
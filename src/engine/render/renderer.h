@@ -2,11 +2,14 @@
 #include "sprite.h"
 #include "../utils/math.h"
 #include <string>
+#include <string_view>
 #include <optional> // For std::optional
 
 struct SDL_Renderer;
+struct SDL_Texture;
 struct SDL_FRect;
 struct SDL_FColor;
+struct SDL_Vertex;
 
 namespace engine::resource {
     class ResourceManager;
@@ -14,6 +17,15 @@ namespace engine::resource {
 
 namespace engine::render {
 class Camera;
+class UIDrawList;
+
+/**
+ * @brief 渲染统计数据（每帧由 GameApp 重置），供调试面板显示。
+ */
+struct RenderStats {
+    int draw_calls_ = 0;    ///< @brief 绘制调用次数
+    int batches_ = 0;       ///< @brief 批次数（相邻两次绘制使用的纹理不同即视为新的批次）
+};
 
 /**
  * @brief 封装 SDL3 渲染操作
@@ -26,6 +38,9 @@ class Renderer final{
 private:
     SDL_Renderer* renderer_ = nullptr;                              ///< @brief 指向 SDL_Renderer 的非拥有指针
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 指向 ResourceManager 的非拥有指针
+
+    RenderStats stats_;                                             ///< @brief 本帧的渲染统计
+    SDL_Texture* last_texture_ = nullptr;                           ///< @brief 上一次绘制使用的纹理（用于统计批次）
     
 public:
     /**
@@ -76,6 +91,29 @@ public:
      */
     void drawUIFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color);
 
+    /**
+     * @brief 将UI精灵录制到绘制列表（与 drawUISprite 的参数含义相同，但不立即绘制）
+     *
+     * @param draw_list 目标绘制列表
+     * @param sprite 包含纹理ID、源矩形和翻转状态的Sprite对象。
+     * @param position 屏幕坐标中的左上角位置。
+     * @param size 可选：目标矩形的大小。如果为 std::nullopt，则使用Sprite的原始大小。
+     */
+    void recordUISprite(UIDrawList& draw_list, const Sprite& sprite, const glm::vec2& position,
+                        const std::optional<glm::vec2>& size = std::nullopt);
+
+    /**
+     * @brief 以一次调用绘制一批屏幕坐标的三角形（UIDrawList 提交时使用）
+     *
+     * @param texture_id 纹理ID，为空时绘制纯色（使用顶点颜色）
+     * @param vertices 顶点数组
+     * @param num_vertices 顶点数
+     * @param indices 索引数组（相对于 vertices）
+     * @param num_indices 索引数
+     */
+    void drawUIGeometry(std::string_view texture_id, const SDL_Vertex* vertices, int num_vertices,
+                        const int* indices, int num_indices);
+
     void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数
     void clearScreen();                                                 ///< @brief 清屏，包装 SDL_RenderClear 函数
 
@@ -84,6 +122,9 @@ public:
 
     SDL_Renderer* getSDLRenderer() const { return renderer_; }          ///< @brief 获取底层的 SDL_Renderer 指针
 
+    const RenderStats& getStats() const { return stats_; }              ///< @brief 获取本帧的渲染统计
+    void resetStats();                                                  ///< @brief 重置渲染统计（每帧开始时调用）
+
     // 禁用拷贝和移动语义
     Renderer(const Renderer&) = delete;
     Renderer& operator=(const Renderer&) = delete;
@@ -93,6 +134,7 @@ public:
 private:
     std::optional<SDL_FRect> getSpriteSrcRect(const Sprite& sprite);     ///< @brief 获取精灵的源矩形，用于具体绘制。出现错误则返回std::nullopt并跳过绘制
     bool isRectInViewport(const Camera& camera, const SDL_FRect& rect);  ///< @brief 判断矩形是否在视口中，用于视口裁剪
+    void countDrawCall(SDL_Texture* texture);                            ///< @brief 记录一次绘制调用（texture 为空代表纯色绘制）
 
 };
 
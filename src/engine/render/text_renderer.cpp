@@ -1,18 +1,23 @@
 #include "text_renderer.h"
 #include "camera.h"
 #include "../resource/resource_manager.h"
+#include "../debug/log.h"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <functional>
+#include <utility>
 
 namespace engine::render {
 
-TextRenderer::TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager)
+TextRenderer::TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager,
+                           std::pmr::memory_resource* frame_memory)
     : sdl_renderer_(sdl_renderer),
-      resource_manager_(resource_manager)
+      resource_manager_(resource_manager),
+      frame_memory_(frame_memory)
 {
-    if (!sdl_renderer_ || !resource_manager_) {
-        throw std::runtime_error("TextRenderer 需要一个有效的 SDL_Renderer 和 ResourceManager。");
+    if (!sdl_renderer_ || !resource_manager_ || !frame_memory_) {
+        throw std::runtime_error("TextRenderer 需要一个有效的 SDL_Renderer、ResourceManager 和帧内存池。");
     }
     // 初始化 SDL_ttf
     if (!TTF_WasInit() && TTF_Init() == false) {
@@ -33,8 +38,16 @@ TextRenderer::~TextRenderer() {
     }
 }
 
+void TTFTextDeleter::operator()(TTF_Text* text) const {
+    if (text) {
+        TTF_DestroyText(text);
+    }
+}
+
 void TextRenderer::close()
 {
+    clearCache();   // 缓存的 TTF_Text 依赖 TTF_TextEngine，需先销毁
+    glyph_batches_.clear();
     if (text_engine_) {
         TTF_DestroyRendererTextEngine(text_engine_);
         text_engine_ = nullptr;
@@ -46,68 +59,307 @@ void TextRenderer::close()
 void TextRenderer::drawUIText(std::string_view text, std::string_view font_id, int font_size,
                               const glm::vec2 &position, const engine::utils::FColor &color)
 {
-    /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
+    TTF_Text* ttf_text = getCachedText(text, font_id, font_size);
+    if (!ttf_text) return;
+    drawTTFText(ttf_text, position, color);
+}
+
+void TextRenderer::drawText(const Camera &camera, std::string_view text, std::string_view font_id, int font_size, 
+                            const glm::vec2 &position, const engine::utils::FColor &color)
+{
+    // 应用相机变换
+    glm::vec2 position_screen = camera.worldToScreen(position);
+
+    // 用新坐标调用drawUIText即可
+    drawUIText(text, font_id, font_size, position_screen, color);
+}
+
+glm::vec2 TextRenderer::getTextSize(std::string_view text, std::string_view font_id, int font_size) {
+    TTF_Text* ttf_text = getCachedText(text, font_id, font_size);
+    if (!ttf_text) return glm::vec2(0.0f, 0.0f);
+
+    int width, height;
+    TTF_GetTextSize(ttf_text, &width, &height);
+    return glm::vec2(static_cast<float>(width), static_cast<float>(height));
+}
+
+// --- 持久文本句柄 ---
+
+TextHandle::~TextHandle()
+{
+    reset();
+}
+
+TextHandle::TextHandle(TextHandle&& other) noexcept
+    : text_(std::move(other.text_)),
+      resource_manager_(std::exchange(other.resource_manager_, nullptr)),
+      font_id_(std::move(other.font_id_)),
+      font_size_(other.font_size_)
+{}
+
+TextHandle& TextHandle::operator=(TextHandle&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        text_ = std::move(other.text_);
+        resource_manager_ = std::exchange(other.resource_manager_, nullptr);
+        font_id_ = std::move(other.font_id_);
+        font_size_ = other.font_size_;
+    }
+    return *this;
+}
+
+void TextHandle::reset()
+{
+    text_.reset();
+    if (resource_manager_) {
+        resource_manager_->release(engine::resource::ResourceType::Font, font_id_, font_size_);
+        resource_manager_ = nullptr;
+    }
+}
+
+TextHandle TextRenderer::createText(std::string_view text, std::string_view font_id, int font_size)
+{
+    TextHandle handle;
     TTF_Font* font = resource_manager_->getFont(font_id, font_size);
     if (!font) {
-        spdlog::warn("drawUIText 获取字体失败: {} 大小 {}", font_id, font_size);
-        return;
+        spdlog::warn("createText 获取字体失败: {} 大小 {}", font_id, font_size);
+        return handle;
     }
+    handle.text_.reset(TTF_CreateText(text_engine_, font, text.data(), text.size()));
+    if (!handle.isValid()) {
+        spdlog::error("createText 创建 TTF_Text 失败: {}", SDL_GetError());
+        return handle;
+    }
+    // 句柄计入字体引用计数，字体在最后一个句柄销毁前不会被卸载
+    resource_manager_->retain(engine::resource::ResourceType::Font, font_id, font_size);
+    handle.resource_manager_ = resource_manager_;
+    handle.font_id_ = font_id;
+    handle.font_size_ = font_size;
+    return handle;
+}
 
-    // 创建临时 TTF_Text 对象   (目前效率不高，未来可以考虑使用缓存优化)
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
-    if (!temp_text_object) {
-        spdlog::error("drawUIText 创建临时 TTF_Text 失败: {}", SDL_GetError());
+bool TextRenderer::setText(TextHandle& handle, std::string_view text)
+{
+    if (!handle.isValid()) return false;
+    if (!TTF_SetTextString(handle.text_.get(), text.data(), text.size())) {
+        spdlog::error("setText 设置文本失败: {}", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+void TextRenderer::drawUIText(const TextHandle& handle, const glm::vec2& position, const engine::utils::FColor& color)
+{
+    if (!handle.isValid()) return;
+    drawTTFText(handle.text_.get(), position, color);
+}
+
+glm::vec2 TextRenderer::getTextSize(const TextHandle& handle) const
+{
+    if (!handle.isValid()) return glm::vec2(0.0f, 0.0f);
+    int width, height;
+    TTF_GetTextSize(handle.text_.get(), &width, &height);
+    return glm::vec2(static_cast<float>(width), static_cast<float>(height));
+}
+
+// --- 图集批量文字 ---
+
+void TextRenderer::drawBatchedUIText(std::string_view text, std::string_view font_id, int font_size,
+                                     const glm::vec2& position, const engine::utils::FColor& color)
+{
+    TTF_Font* font = resource_manager_->getFont(font_id, font_size);
+    if (!font) {
+        ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "drawBatchedUIText 获取字体失败: {} 大小 {}", font_id, font_size);
         return;
     }
 
-    // 先渲染一次黑色文字模拟阴影
-    TTF_SetTextColorFloat(temp_text_object, 0.0f, 0.0f, 0.0f, 1.0f);
-    if (!TTF_DrawRendererText(temp_text_object, position.x + 2, position.y + 2)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+    auto& batch = glyph_batches_.try_emplace(font, frame_memory_).first->second;
+    if (!batch.atlas_) {
+        try {
+            batch.atlas_ = std::make_unique<GlyphAtlas>(sdl_renderer_, font);
+        } catch (const std::exception& e) {
+            spdlog::error("创建字形图集失败: {}", e.what());
+            glyph_batches_.erase(font);
+            return;
+        }
     }
 
-    // 然后正常绘制
-    TTF_SetTextColorFloat(temp_text_object, color.r, color.g, color.b, color.a);
-    if (!TTF_DrawRendererText(temp_text_object, position.x, position.y)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+    // 先追加全部阴影再追加正文，保证阴影不会覆盖相邻字形
+    appendGlyphQuads(batch, text, position + glm::vec2(2.0f, 2.0f), SDL_FColor{0.0f, 0.0f, 0.0f, color.a});
+    appendGlyphQuads(batch, text, position, SDL_FColor{color.r, color.g, color.b, color.a});
+}
+
+void TextRenderer::drawBatchedText(const Camera& camera, std::string_view text, std::string_view font_id, int font_size,
+                                   const glm::vec2& position, const engine::utils::FColor& color)
+{
+    drawBatchedUIText(text, font_id, font_size, camera.worldToScreen(position), color);
+}
+
+void TextRenderer::flushBatchedText()
+{
+    for (auto& [font, batch] : glyph_batches_) {
+        if (batch.indices_.empty()) continue;
+        ++draw_calls_;
+        if (!SDL_RenderGeometry(sdl_renderer_, batch.atlas_->getTexture(),
+                                batch.vertices_.data(), static_cast<int>(batch.vertices_.size()),
+                                batch.indices_.data(), static_cast<int>(batch.indices_.size()))) {
+            ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "flushBatchedText 绘制失败: {}", SDL_GetError());
+        }
+        releaseBatch(batch);
     }
+}
 
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(temp_text_object);
+void TextRenderer::discardBatchedText()
+{
+    // 在 flushBatchedText() 之后录制、没有提交的文字：其缓冲区即将随帧内存池一起失效
+    for (auto& [font, batch] : glyph_batches_) {
+        releaseBatch(batch);
+    }
 }
 
-void TextRenderer::drawText(const Camera &camera, std::string_view text, std::string_view font_id, int font_size, 
-                            const glm::vec2 &position, const engine::utils::FColor &color)
+void TextRenderer::releaseBatch(GlyphBatch& batch)
 {
-    // 应用相机变换
-    glm::vec2 position_screen = camera.worldToScreen(position);
+    // 与空容器交换（分配器相同），旧缓冲区的释放是空操作，帧内存池重置时整体回收
+    std::pmr::vector<SDL_Vertex>(batch.vertices_.get_allocator()).swap(batch.vertices_);
+    std::pmr::vector<int>(batch.indices_.get_allocator()).swap(batch.indices_);
+}
 
-    // 用新坐标调用drawUIText即可
-    drawUIText(text, font_id, font_size, position_screen, color);
+void TextRenderer::appendGlyphQuads(GlyphBatch& batch, std::string_view text, glm::vec2 position, const SDL_FColor& color)
+{
+    auto* atlas = batch.atlas_.get();
+    float inv_w = 0.0f, inv_h = 0.0f;
+    {
+        float tex_w = 0.0f, tex_h = 0.0f;
+        SDL_GetTextureSize(atlas->getTexture(), &tex_w, &tex_h);
+        inv_w = 1.0f / tex_w;
+        inv_h = 1.0f / tex_h;
+    }
+
+    float pen_x = position.x;
+    float pen_y = position.y;
+    const char* cursor = text.data();
+    std::size_t remaining = text.size();
+    while (remaining > 0) {
+        Uint32 codepoint = SDL_StepUTF8(&cursor, &remaining);
+        if (codepoint == '\n') {
+            pen_x = position.x;
+            pen_y += static_cast<float>(atlas->getLineHeight());
+            continue;
+        }
+        const Glyph* glyph = atlas->getGlyph(codepoint);
+        if (!glyph) continue;
+
+        const SDL_FRect& src = glyph->src_rect_;
+        if (src.w > 0.0f && src.h > 0.0f) {
+            int base = static_cast<int>(batch.vertices_.size());
+            float u0 = src.x * inv_w, v0 = src.y * inv_h;
+            float u1 = (src.x + src.w) * inv_w, v1 = (src.y + src.h) * inv_h;
+            batch.vertices_.push_back(SDL_Vertex{SDL_FPoint{pen_x, pen_y}, color, SDL_FPoint{u0, v0}});
+            batch.vertices_.push_back(SDL_Vertex{SDL_FPoint{pen_x + src.w, pen_y}, color, SDL_FPoint{u1, v0}});
+            batch.vertices_.push_back(SDL_Vertex{SDL_FPoint{pen_x + src.w, pen_y + src.h}, color, SDL_FPoint{u1, v1}});
+            batch.vertices_.push_back(SDL_Vertex{SDL_FPoint{pen_x, pen_y + src.h}, color, SDL_FPoint{u0, v1}});
+            batch.indices_.insert(batch.indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        pen_x += glyph->advance_;
+    }
 }
 
-glm::vec2 TextRenderer::getTextSize(std::string_view text, std::string_view font_id, int font_size) {
+// --- 缓存 ---
+
+void TextRenderer::clearCache()
+{
+    text_cache_index_.clear();
+    text_cache_.clear();
+    glyph_batches_.clear();     // 图集同样以字体指针为键，字体释放后失效
+}
+
+void TextRenderer::releaseFont(TTF_Font* font)
+{
+    for (auto it = text_cache_.begin(); it != text_cache_.end();) {
+        if (it->font_ == font) {
+            text_cache_index_.erase(it->key_);
+            it = text_cache_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    glyph_batches_.erase(font);
+}
+
+void TextRenderer::setCacheCapacity(std::size_t capacity)
+{
+    text_cache_capacity_ = capacity > 0 ? capacity : 1;
+    while (text_cache_.size() > text_cache_capacity_) {
+        text_cache_index_.erase(text_cache_.back().key_);
+        text_cache_.pop_back();
+    }
+}
+
+engine::resource::CacheStats TextRenderer::getCacheStats() const
+{
+    engine::resource::CacheStats stats = text_cache_stats_;
+    stats.entries_ = text_cache_.size();
+    return stats;
+}
+
+TTF_Text* TextRenderer::getCachedText(std::string_view text, std::string_view font_id, int font_size)
+{
     /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
     TTF_Font* font = resource_manager_->getFont(font_id, font_size);
     if (!font) {
-        spdlog::warn("getTextSize 获取字体失败: {} 大小 {}", font_id, font_size);
-        return glm::vec2(0.0f, 0.0f);
+        ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "获取字体失败: {} 大小 {}", font_id, font_size);
+        return nullptr;
     }
 
-    // 创建临时 TTF_Text 对象
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
-    if (!temp_text_object) {
-        spdlog::error("getTextSize 创建临时 TTF_Text 失败: {}", SDL_GetError());
-        return glm::vec2(0.0f, 0.0f);
+    // 字体指针已经区分了字体文件和大小，再与字符串哈希组合成键
+    std::size_t key = std::hash<std::string_view>{}(text);
+    key ^= std::hash<const void*>{}(font) + 0x9e3779b9 + (key << 6) + (key >> 2);
+
+    if (auto it = text_cache_index_.find(key); it != text_cache_index_.end()) {
+        auto entry = it->second;
+        if (entry->font_ == font && entry->text_ == text) {
+            ++text_cache_stats_.hits_;
+            text_cache_.splice(text_cache_.begin(), text_cache_, entry);    // 移到表头（最近使用）
+            return entry->ttf_text_.get();
+        }
+        // 哈希冲突：丢弃旧条目，下面重新创建
+        text_cache_.erase(entry);
+        text_cache_index_.erase(it);
     }
 
-    int width, height;
-    TTF_GetTextSize(temp_text_object, &width, &height);
+    ++text_cache_stats_.misses_;
+    std::unique_ptr<TTF_Text, TTFTextDeleter> ttf_text(TTF_CreateText(text_engine_, font, text.data(), text.size()));
+    if (!ttf_text) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "创建 TTF_Text 失败: {}", SDL_GetError());
+        return nullptr;
+    }
 
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(temp_text_object);
+    // 超出容量则淘汰最久未使用的条目
+    if (text_cache_.size() >= text_cache_capacity_) {
+        text_cache_index_.erase(text_cache_.back().key_);
+        text_cache_.pop_back();
+    }
+    text_cache_.push_front(CachedText{key, font, std::string(text), std::move(ttf_text)});
+    text_cache_index_[key] = text_cache_.begin();
+    return text_cache_.front().ttf_text_.get();
+}
 
-    return glm::vec2(static_cast<float>(width), static_cast<float>(height));
-} 
+void TextRenderer::drawTTFText(TTF_Text* text, const glm::vec2& position, const engine::utils::FColor& color)
+{
+    draw_calls_ += 2;
+
+    // 先渲染一次黑色文字模拟阴影
+    TTF_SetTextColorFloat(text, 0.0f, 0.0f, 0.0f, 1.0f);
+    if (!TTF_DrawRendererText(text, position.x + 2, position.y + 2)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "绘制 TTF_Text 阴影失败: {}", SDL_GetError());
+    }
+
+    // 然后正常绘制
+    TTF_SetTextColorFloat(text, color.r, color.g, color.b, color.a);
+    if (!TTF_DrawRendererText(text, position.x, position.y)) {
+        ENGINE_LOG_THROTTLED(spdlog::level::err, 1000, "绘制 TTF_Text 失败: {}", SDL_GetError());
+    }
+}
 
 } // namespace engine::render 
\ No newline at end of file
@@ -1,11 +1,21 @@
 #pragma once
 #include <SDL3/SDL_render.h>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <glm/vec2.hpp>
 #include "../utils/math.h"
+#include "../resource/cache_stats.h"
+#include "glyph_atlas.h"
+#include <vector>
 
 struct TTF_TextEngine;
+struct TTF_Text;
+struct TTF_Font;
 
 namespace engine::resource {
     class ResourceManager;
@@ -13,18 +23,85 @@ namespace engine::resource {
 
 namespace engine::render {
     class Camera;
+
+/// @brief TTF_Text 的删除器（定义在 cpp 中，避免头文件依赖 SDL_ttf）
+struct TTFTextDeleter {
+    void operator()(TTF_Text* text) const;
+};
+
+/**
+ * @brief 持久文本句柄，独占一个已排版的 TTF_Text。
+ *
+ * 由 TextRenderer::createText() 创建，适用于内容很少变化的文本（如 UILabel）。
+ * 只在文本内容改变时重新排版。必须在 TextRenderer 关闭前销毁。
+ * 句柄存活期间持有所用字体的一个引用（ResourceManager::retain），
+ * 场景弹出等释放字体引用的操作不会关闭仍被句柄使用的 TTF_Font。
+ */
+class TextHandle final {
+    friend class TextRenderer;
+
+private:
+    std::unique_ptr<TTF_Text, TTFTextDeleter> text_;    ///< @brief 持有的 TTF_Text
+    engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 用于释放字体引用（为空表示未持有引用）
+    std::string font_id_;                               ///< @brief 所用字体
+    int font_size_ = 0;                                 ///< @brief 所用字体大小
+
+public:
+    TextHandle() = default;
+    ~TextHandle();                                      ///< @brief 销毁 TTF_Text 并释放字体引用
+
+    // 只能移动（字体引用随之转移）
+    TextHandle(const TextHandle&) = delete;
+    TextHandle& operator=(const TextHandle&) = delete;
+    TextHandle(TextHandle&& other) noexcept;
+    TextHandle& operator=(TextHandle&& other) noexcept;
+
+    bool isValid() const { return text_ != nullptr; }   ///< @brief 句柄是否有效
+
+private:
+    void reset();                                       ///< @brief 销毁 TTF_Text，然后释放字体引用（顺序不能颠倒）
+};
+
 /**
  * @brief 使用 SDL_ttf 和 TTF_Text 对象处理文本渲染。
  *
  * 封装 TTF_TextEngine 并提供创建和绘制 TTF_Text 对象的方法，
- * 管理字体加载和颜色设置。
+ * 管理字体加载和颜色设置。临时文本通过 LRU 缓存复用已排版的 TTF_Text，
+ * 相同字体与内容的文本不会每帧重复排版。
  */
 class TextRenderer final {
 private:
+    static constexpr std::size_t DEFAULT_TEXT_CACHE_CAPACITY = 256;     ///< @brief 默认 LRU 缓存容量
+
+    /// @brief LRU 缓存条目（字体指针已区分字体文件与大小）
+    struct CachedText {
+        std::size_t key_;                                   ///< @brief (字体, 字符串) 的组合哈希
+        TTF_Font* font_;                                    ///< @brief 所用字体
+        std::string text_;                                  ///< @brief 文本内容（用于哈希冲突时的校验）
+        std::unique_ptr<TTF_Text, TTFTextDeleter> ttf_text_;
+    };
+
     SDL_Renderer* sdl_renderer_ = nullptr;                          ///< @brief 持有渲染器的非拥有指针
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 持有资源管理器的非拥有指针
-    
+
     TTF_TextEngine* text_engine_ = nullptr;         ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制
+    int draw_calls_ = 0;                            ///< @brief 本帧的文字绘制调用次数（含阴影）
+
+    std::list<CachedText> text_cache_;                                              ///< @brief LRU 链表，表头为最近使用
+    std::unordered_map<std::size_t, std::list<CachedText>::iterator> text_cache_index_; ///< @brief 键 -> 链表节点
+    std::size_t text_cache_capacity_ = DEFAULT_TEXT_CACHE_CAPACITY;                 ///< @brief 缓存容量
+    engine::resource::CacheStats text_cache_stats_;                                 ///< @brief 缓存命中统计
+
+    /// @brief 一种字体（文件 + 大小）的字形图集及其本帧待提交的顶点（顶点与索引从帧内存池分配）
+    struct GlyphBatch {
+        std::unique_ptr<GlyphAtlas> atlas_;
+        std::pmr::vector<SDL_Vertex> vertices_;
+        std::pmr::vector<int> indices_;
+
+        explicit GlyphBatch(std::pmr::memory_resource* frame_memory) : vertices_(frame_memory), indices_(frame_memory) {}
+    };
+    std::unordered_map<TTF_Font*, GlyphBatch> glyph_batches_;                       ///< @brief 字体 -> 图集批次
+    std::pmr::memory_resource* frame_memory_ = nullptr;                             ///< @brief 帧内存池（非拥有，每帧开始时重置）
 
 public:
     /**
@@ -32,9 +109,11 @@ public:
      *
      * @param sdl_renderer 有效的 SDL_Renderer 指针。
      * @param resource_manager 有效的 ResourceManager 指针（用于字体加载）。
+     * @param frame_memory 有效的帧内存池（图集批次的顶点只在一帧内有效，从中分配）。
      * @throws std::runtime_error 如果初始化失败。
      */
-    TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager);
+    TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager,
+                 std::pmr::memory_resource* frame_memory);
 
     ~TextRenderer();            ///< @brief 析构函数，按需调用close()。
 
@@ -42,19 +121,19 @@ public:
 
     /**
      * @brief 绘制UI上的字符串。
-     *        
+     *
      * @param text UTF-8 字符串内容。
      * @param font_id 字体 ID。
      * @param font_size 字体大小。
      * @param position 左上角屏幕位置。
      * @param color 文本颜色。(默认为白色)
      */
-    void drawUIText(std::string_view text, std::string_view font_id, int font_size, 
+    void drawUIText(std::string_view text, std::string_view font_id, int font_size,
                   const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
 
     /**
      * @brief 绘制地图上的字符串。
-     *        
+     *
      * @param camera 相机
      * @param text UTF-8 字符串内容。
      * @param font_id 字体 ID。
@@ -62,7 +141,7 @@ public:
      * @param position 左上角屏幕位置。
      * @param color 文本颜色。
      */
-    void drawText(const Camera& camera, std::string_view text, std::string_view font_id, int font_size, 
+    void drawText(const Camera& camera, std::string_view text, std::string_view font_id, int font_size,
                   const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
 
     /**
@@ -75,12 +154,56 @@ public:
      */
     glm::vec2 getTextSize(std::string_view text, std::string_view font_id, int font_size);
 
+    // --- 持久文本句柄 ---
+    /**
+     * @brief 创建持久文本句柄。
+     * @return 文本句柄，失败时返回无效句柄。
+     */
+    TextHandle createText(std::string_view text, std::string_view font_id, int font_size);
+    bool setText(TextHandle& handle, std::string_view text);       ///< @brief 修改句柄的文本内容（会重新排版）
+    void drawUIText(const TextHandle& handle, const glm::vec2& position,
+                    const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});   ///< @brief 在屏幕坐标绘制句柄
+    glm::vec2 getTextSize(const TextHandle& handle) const;          ///< @brief 获取句柄文本的尺寸
+
+    // --- 图集批量文字 (像素字体，适合大量伤害数字/血量标签) ---
+    /**
+     * @brief 将文字加入字形图集批次（屏幕坐标），在 flushBatchedText() 时一次性绘制。
+     *
+     * 字形按需光栅化到图集中，同一字体的所有文字只需一次绘制调用。
+     * 不经过 SDL_ttf 排版（无字距调整等），适合像素字体的短文本。
+     */
+    void drawBatchedUIText(std::string_view text, std::string_view font_id, int font_size,
+                           const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
+    /// @brief 同 drawBatchedUIText，但使用世界坐标（应用相机变换）
+    void drawBatchedText(const Camera& camera, std::string_view text, std::string_view font_id, int font_size,
+                         const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
+    void flushBatchedText();                                        ///< @brief 提交所有批次（每种字体一次 SDL_RenderGeometry）
+    void discardBatchedText();                                      ///< @brief 丢弃未提交的批次（帧内存池重置前调用）
+
+    // --- 缓存 ---
+    void clearCache();                                              ///< @brief 清空临时文本缓存（卸载字体前必须调用）
+    void releaseFont(TTF_Font* font);                               ///< @brief 丢弃使用该字体的临时文本与字形图集（字体卸载前调用）
+    void setCacheCapacity(std::size_t capacity);                    ///< @brief 设置缓存容量（至少为 1）
+    engine::resource::CacheStats getCacheStats() const;             ///< @brief 获取缓存统计
+
+    int getDrawCallCount() const { return draw_calls_; }    ///< @brief 获取本帧的文字绘制调用次数
+    void resetStats() { draw_calls_ = 0; }                  ///< @brief 重置统计（每帧开始时调用）
+
     // 禁用拷贝和移动语义
     TextRenderer(const TextRenderer&) = delete;
     TextRenderer& operator=(const TextRenderer&) = delete;
     TextRenderer(TextRenderer&&) = delete;
     TextRenderer& operator=(TextRenderer&&) = delete;
 
+private:
+    /// @brief 从 LRU 缓存获取（或创建）已排版的 TTF_Text，失败返回 nullptr
+    TTF_Text* getCachedText(std::string_view text, std::string_view font_id, int font_size);
+    /// @brief 绘制阴影与正文
+    void drawTTFText(TTF_Text* text, const glm::vec2& position, const engine::utils::FColor& color);
+    /// @brief 向批次追加一串字形四边形
+    static void releaseBatch(GlyphBatch& batch);                    ///< @brief 放弃批次的顶点缓冲区（内存由帧内存池整体回收）
+    void appendGlyphQuads(GlyphBatch& batch, std::string_view text, glm::vec2 position, const SDL_FColor& color);
+
 }; // class TextRenderer
 
-} // namespace engine::render
\ No newline at end of file
+} // namespace engine::render
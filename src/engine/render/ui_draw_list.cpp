@@ -0,0 +1,80 @@
+#include "ui_draw_list.h"
+#include "renderer.h"
+#include "text_renderer.h"
+#include <utility>
+
+namespace engine::render {
+
+void UIDrawList::clear() {
+    vertices_.clear();
+    indices_.clear();
+    commands_.clear();
+    texture_ids_.clear();
+}
+
+void UIDrawList::addFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color) {
+    appendQuad({}, rect, engine::utils::Rect{{0.0f, 0.0f}, {0.0f, 0.0f}}, false,
+               SDL_FColor{color.r, color.g, color.b, color.a});
+}
+
+void UIDrawList::addTexturedRect(std::string_view texture_id, const engine::utils::Rect& uv_rect,
+                                 const engine::utils::Rect& rect, bool is_flipped) {
+    if (texture_id.empty()) return;     // 空ID保留给纯色批次
+    appendQuad(texture_id, rect, uv_rect, is_flipped, SDL_FColor{1.0f, 1.0f, 1.0f, 1.0f});
+}
+
+void UIDrawList::addText(const TextHandle& handle, const glm::vec2& position, const engine::utils::FColor& color) {
+    auto& command = commands_.emplace_back();
+    command.text_ = &handle;
+    command.text_position_ = position;
+    command.text_color_ = color;
+}
+
+void UIDrawList::submit(Renderer& renderer, TextRenderer& text_renderer) const {
+    for (const auto& command : commands_) {
+        if (command.text_) {
+            text_renderer.drawUIText(*command.text_, command.text_position_, command.text_color_);
+        } else {
+            renderer.drawUIGeometry(getTextureId(command),
+                                    vertices_.data() + command.first_vertex_, command.vertex_count_,
+                                    indices_.data() + command.first_index_, command.index_count_);
+        }
+    }
+}
+
+void UIDrawList::appendQuad(std::string_view texture_id, const engine::utils::Rect& rect,
+                            const engine::utils::Rect& uv_rect, bool is_flipped, const SDL_FColor& color) {
+    if (commands_.empty() || commands_.back().text_ || getTextureId(commands_.back()) != texture_id) {
+        auto& command = commands_.emplace_back();
+        command.texture_offset_ = texture_ids_.size();
+        command.texture_length_ = texture_id.size();
+        texture_ids_.append(texture_id);
+        command.first_vertex_ = static_cast<int>(vertices_.size());
+        command.first_index_ = static_cast<int>(indices_.size());
+    }
+    auto& command = commands_.back();
+
+    // 水平翻转只需交换左右两侧的纹理坐标
+    float u0 = uv_rect.position.x;
+    float u1 = uv_rect.position.x + uv_rect.size.x;
+    if (is_flipped) std::swap(u0, u1);
+    const float v0 = uv_rect.position.y;
+    const float v1 = uv_rect.position.y + uv_rect.size.y;
+    const float x0 = rect.position.x;
+    const float x1 = rect.position.x + rect.size.x;
+    const float y0 = rect.position.y;
+    const float y1 = rect.position.y + rect.size.y;
+
+    const int base = command.vertex_count_;     // 索引相对于批次首个顶点
+    vertices_.push_back(SDL_Vertex{{x0, y0}, color, {u0, v0}});
+    vertices_.push_back(SDL_Vertex{{x1, y0}, color, {u1, v0}});
+    vertices_.push_back(SDL_Vertex{{x1, y1}, color, {u1, v1}});
+    vertices_.push_back(SDL_Vertex{{x0, y1}, color, {u0, v1}});
+    for (int offset : {0, 1, 2, 0, 2, 3}) {
+        indices_.push_back(base + offset);
+    }
+    command.vertex_count_ += 4;
+    command.index_count_ += 6;
+}
+
+} // namespace engine::render
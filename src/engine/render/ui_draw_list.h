@@ -0,0 +1,102 @@
+#pragma once
+#include <SDL3/SDL_render.h>    // 用于 SDL_Vertex
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <glm/vec2.hpp>
+#include "../utils/math.h"
+
+namespace engine::render {
+class Renderer;
+class TextRenderer;
+class TextHandle;
+
+/**
+ * @brief UI 的保留式绘制列表。
+ *
+ * 由 UIManager 持有，只在 UI 树发生变化后重新录制，其余帧直接提交上一次的结果。
+ * 提交时，使用同一纹理的相邻四边形合并为一次 SDL_RenderGeometry，相邻的纯色矩形同理；
+ * 文字(TTF_Text)无法并入几何批次，作为单独的命令按录制顺序穿插提交，保证绘制顺序不变。
+ * 批次只记录纹理ID，提交时再解析，纹理被淘汰或热重载后不会留下悬空指针。
+ * 绘制列表跨帧保留，因此不使用帧内存池；所有缓冲区（包括纹理ID）在 clear() 后保留容量，
+ * 重新录制时不产生堆分配。
+ */
+class UIDrawList final {
+public:
+    /// @brief 一条绘制命令：一个几何批次，或一段文字
+    struct Command {
+        std::size_t texture_offset_ = 0;            ///< @brief 批次纹理ID在 texture_ids_ 中的起始位置
+        std::size_t texture_length_ = 0;            ///< @brief 批次纹理ID的长度（为0表示纯色）
+        int first_vertex_ = 0;                      ///< @brief 批次在 vertices_ 中的起始位置
+        int vertex_count_ = 0;                      ///< @brief 批次的顶点数
+        int first_index_ = 0;                       ///< @brief 批次在 indices_ 中的起始位置（索引相对于批次首个顶点）
+        int index_count_ = 0;                       ///< @brief 批次的索引数
+        const TextHandle* text_ = nullptr;          ///< @brief 非空时为文字命令（句柄由 UILabel 持有）
+        glm::vec2 text_position_ = {0.0f, 0.0f};    ///< @brief 文字的屏幕位置
+        engine::utils::FColor text_color_ = {1.0f, 1.0f, 1.0f, 1.0f};  ///< @brief 文字颜色
+    };
+
+private:
+    std::vector<SDL_Vertex> vertices_;      ///< @brief 所有批次的顶点
+    std::vector<int> indices_;              ///< @brief 所有批次的索引
+    std::vector<Command> commands_;         ///< @brief 按绘制顺序排列的命令
+    std::string texture_ids_;               ///< @brief 所有批次的纹理ID首尾相连（命令只保存位置，避免每条命令一个字符串）
+
+public:
+    UIDrawList() = default;
+
+    void clear();                                                   ///< @brief 清空（保留容量，重新录制时不再分配）
+    bool empty() const { return commands_.empty(); }                ///< @brief 是否没有任何命令
+    std::size_t getCommandCount() const { return commands_.size(); }    ///< @brief 命令数（提交时的绘制调用数）
+
+    /**
+     * @brief 录制一个纯色矩形
+     * @param rect 屏幕坐标中的矩形
+     * @param color 填充颜色
+     */
+    void addFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color);
+
+    /**
+     * @brief 录制一个带纹理的矩形
+     * @param texture_id 纹理ID
+     * @param uv_rect 归一化的纹理坐标矩形
+     * @param rect 屏幕坐标中的目标矩形
+     * @param is_flipped 是否水平翻转
+     */
+    void addTexturedRect(std::string_view texture_id, const engine::utils::Rect& uv_rect,
+                         const engine::utils::Rect& rect, bool is_flipped);
+
+    /**
+     * @brief 录制一段文字（持久文本句柄在提交前必须保持有效）
+     * @param handle 文本句柄
+     * @param position 左上角屏幕位置
+     * @param color 文本颜色
+     */
+    void addText(const TextHandle& handle, const glm::vec2& position, const engine::utils::FColor& color);
+
+    /**
+     * @brief 提交所有命令
+     * @param renderer 用于几何批次
+     * @param text_renderer 用于文字命令
+     */
+    void submit(Renderer& renderer, TextRenderer& text_renderer) const;
+
+    // 禁用拷贝和移动语义
+    UIDrawList(const UIDrawList&) = delete;
+    UIDrawList& operator=(const UIDrawList&) = delete;
+    UIDrawList(UIDrawList&&) = delete;
+    UIDrawList& operator=(UIDrawList&&) = delete;
+
+private:
+    /// @brief 获取命令的纹理ID（为空表示纯色）
+    std::string_view getTextureId(const Command& command) const {
+        return std::string_view(texture_ids_).substr(command.texture_offset_, command.texture_length_);
+    }
+
+    /// @brief 向最后一个批次追加四边形；纹理不同（或上一条是文字）时开启新批次
+    void appendQuad(std::string_view texture_id, const engine::utils::Rect& rect,
+                    const engine::utils::Rect& uv_rect, bool is_flipped, const SDL_FColor& color);
+};
+
+} // namespace engine::render
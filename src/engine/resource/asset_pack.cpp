@@ -0,0 +1,222 @@
+#include "asset_pack.h"
+#include "pack_format.h"
+#include <SDL3/SDL_iostream.h>
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::resource {
+
+namespace {
+/// @brief 从映射内存中按小端序读取一个整数（不要求对齐）
+template <typename T>
+T readValue(const std::byte* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+} // namespace
+
+AssetPack::~AssetPack()
+{
+    unmount();
+}
+
+bool AssetPack::mount(std::string_view pack_path)
+{
+    unmount();
+    std::string path(pack_path);
+    if (!mapFile(path)) return false;
+
+    auto fail = [&](std::string_view reason) {
+        spdlog::error("资源包 '{}' 无效: {}", pack_path, reason);
+        unmount();
+        return false;
+    };
+
+    if (size_ < sizeof(pack::PackHeader)) return fail("文件过小");
+    pack::PackHeader header;
+    std::memcpy(&header, data_, sizeof(header));
+    if (header.magic_ != pack::PACK_MAGIC) return fail("文件标识不匹配");
+    if (header.version_ != pack::PACK_VERSION) return fail("版本不支持");
+    if (header.toc_offset_ > size_) return fail("目录偏移越界");
+
+    // 解析目录
+    const std::byte* cursor = data_ + header.toc_offset_;
+    const std::byte* end = data_ + size_;
+    entries_.reserve(header.entry_count_);
+    for (std::uint32_t i = 0; i < header.entry_count_; ++i) {
+        constexpr std::size_t FIXED_SIZE = sizeof(std::uint64_t) * 3 + sizeof(std::uint32_t);
+        if (static_cast<std::size_t>(end - cursor) < FIXED_SIZE) return fail("目录被截断");
+        auto hash = readValue<std::uint64_t>(cursor);
+        Entry entry;
+        entry.offset_ = readValue<std::uint64_t>(cursor + 8);
+        entry.size_ = readValue<std::uint64_t>(cursor + 16);
+        auto path_length = readValue<std::uint32_t>(cursor + 24);
+        cursor += FIXED_SIZE;
+
+        if (static_cast<std::size_t>(end - cursor) < path_length) return fail("目录被截断");
+        entry.path_.assign(reinterpret_cast<const char*>(cursor), path_length);
+        cursor += path_length;
+        if (entry.offset_ > size_ || entry.size_ > size_ - entry.offset_) return fail("文件数据越界");
+
+        entries_.emplace(hash, std::move(entry));
+    }
+
+    base_dir_ = std::filesystem::current_path();
+    pack_path_ = std::move(path);
+    spdlog::info("已挂载资源包 '{}'：{} 个文件，{:.1f} MB。", pack_path_, entries_.size(), size_ / (1024.0 * 1024.0));
+    return true;
+}
+
+void AssetPack::unmount()
+{
+    entries_.clear();
+    unmapFile();
+    pack_path_.clear();
+}
+
+SDL_IOStream* AssetPack::open(std::string_view path) const
+{
+    if (const Entry* entry = find(path)) {
+        return SDL_IOFromConstMem(data_ + entry->offset_, static_cast<std::size_t>(entry->size_));
+    }
+    return SDL_IOFromFile(std::string(path).c_str(), "rb");
+}
+
+std::optional<std::string> AssetPack::readText(std::string_view path) const
+{
+    if (const Entry* entry = find(path)) {
+        return std::string(reinterpret_cast<const char*>(data_ + entry->offset_), static_cast<std::size_t>(entry->size_));
+    }
+    return readLooseText(path);
+}
+
+std::optional<std::string> AssetPack::readLooseText(std::string_view path)
+{
+    std::ifstream file{std::string(path), std::ios::binary};
+    if (!file.is_open()) return std::nullopt;
+    std::ostringstream content;
+    content << file.rdbuf();
+    return std::move(content).str();
+}
+
+bool AssetPack::contains(std::string_view path) const
+{
+    return find(path) != nullptr;
+}
+
+const AssetPack::Entry* AssetPack::find(std::string_view path) const
+{
+    if (entries_.empty()) return nullptr;
+    std::string key = normalize(path);
+    auto [begin, end] = entries_.equal_range(pack::hashPath(key));
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.path_ == key) return &it->second;
+    }
+    return nullptr;
+}
+
+std::string AssetPack::normalize(std::string_view path) const
+{
+    std::filesystem::path file_path(path);
+    if (file_path.is_absolute()) {      // 如 LevelLoader 通过 canonical 得到的绝对路径
+        file_path = file_path.lexically_relative(base_dir_);
+    }
+    return file_path.lexically_normal().generic_string();
+}
+
+#ifdef _WIN32
+
+bool AssetPack::mapFile(const std::string& pack_path)
+{
+    HANDLE file = CreateFileA(pack_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        spdlog::info("未找到资源包 '{}'，使用散文件。", pack_path);
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        spdlog::error("无法映射资源包 '{}'。", pack_path);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        spdlog::error("无法映射资源包 '{}'。", pack_path);
+        return false;
+    }
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    data_ = static_cast<const std::byte*>(view);
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    return true;
+}
+
+void AssetPack::unmapFile()
+{
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_handle_) CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    if (file_handle_) CloseHandle(static_cast<HANDLE>(file_handle_));
+    data_ = nullptr;
+    size_ = 0;
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+}
+
+#else
+
+bool AssetPack::mapFile(const std::string& pack_path)
+{
+    int fd = ::open(pack_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        spdlog::info("未找到资源包 '{}'，使用散文件。", pack_path);
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);    // 映射建立后即可关闭文件描述符
+    if (view == MAP_FAILED) {
+        spdlog::error("无法映射资源包 '{}'。", pack_path);
+        return false;
+    }
+    data_ = static_cast<const std::byte*>(view);
+    size_ = static_cast<std::size_t>(file_stat.st_size);
+    return true;
+}
+
+void AssetPack::unmapFile()
+{
+    if (data_) munmap(const_cast<std::byte*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+} // namespace engine::resource
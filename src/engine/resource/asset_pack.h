@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct SDL_IOStream;
+
+namespace engine::resource {
+
+/**
+ * @brief 只读资源包：启动时将 .pak 文件整体内存映射，按路径哈希查找文件。
+ *
+ * open() 返回指向映射内存的 SDL_IOStream 视图，不再逐个打开/stat 散文件；
+ * 包中没有的路径回退到磁盘文件（开发时可以不打包）。
+ * 挂载后只读，可在多个线程中同时使用。
+ */
+class AssetPack final {
+private:
+    /// @brief 目录条目
+    struct Entry {
+        std::string path_;              ///< @brief 规范化后的路径（用于哈希冲突时的校验）
+        std::uint64_t offset_ = 0;      ///< @brief 数据在包中的偏移
+        std::uint64_t size_ = 0;        ///< @brief 数据大小
+    };
+
+    const std::byte* data_ = nullptr;                   ///< @brief 映射的起始地址
+    std::size_t size_ = 0;                              ///< @brief 映射的大小
+    std::unordered_multimap<std::uint64_t, Entry> entries_; ///< @brief 路径哈希 -> 条目
+    std::filesystem::path base_dir_;                    ///< @brief 解析绝对路径时的基准目录（挂载时的工作目录）
+    std::string pack_path_;                             ///< @brief 已挂载的包路径
+
+#ifdef _WIN32
+    void* file_handle_ = nullptr;                       ///< @brief Windows 文件句柄
+    void* mapping_handle_ = nullptr;                    ///< @brief Windows 映射句柄
+#endif
+
+public:
+    AssetPack() = default;
+    ~AssetPack();
+
+    // 禁止拷贝和移动
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+    AssetPack(AssetPack&&) = delete;
+    AssetPack& operator=(AssetPack&&) = delete;
+
+    /**
+     * @brief 挂载资源包（已挂载时先卸载）。
+     * @param pack_path .pak 文件路径。
+     * @return 成功返回 true；文件不存在或格式错误返回 false（此时所有读取回退到磁盘文件）。
+     */
+    bool mount(std::string_view pack_path);
+    void unmount();                                     ///< @brief 卸载资源包并解除映射
+
+    /**
+     * @brief 打开文件：包中存在时返回内存视图，否则打开磁盘文件。
+     * @return SDL_IOStream（调用者负责关闭，或交给 *_IO(..., true) 接口关闭）；失败返回 nullptr。
+     */
+    SDL_IOStream* open(std::string_view path) const;
+
+    /**
+     * @brief 读取整个文本文件（如 JSON）。包中不存在时从磁盘读取。
+     * @return 文件内容；失败返回 std::nullopt。
+     */
+    std::optional<std::string> readText(std::string_view path) const;
+
+    /**
+     * @brief 直接读取磁盘上的散文件，忽略资源包（热重载用：包中的是打包时的旧内容）。
+     * @return 文件内容；失败返回 std::nullopt。
+     */
+    static std::optional<std::string> readLooseText(std::string_view path);
+
+    bool contains(std::string_view path) const;         ///< @brief 包中是否存在该文件
+    bool isMounted() const { return data_ != nullptr; } ///< @brief 是否已挂载
+    std::size_t getFileCount() const { return entries_.size(); }    ///< @brief 包中的文件数量
+    std::size_t getMappedSize() const { return size_; }             ///< @brief 映射的字节数
+
+private:
+    const Entry* find(std::string_view path) const;     ///< @brief 查找条目，不存在返回 nullptr
+    std::string normalize(std::string_view path) const; ///< @brief 规范化路径（绝对路径转为相对基准目录的正斜杠路径）
+    bool mapFile(const std::string& pack_path);         ///< @brief 平台相关的内存映射
+    void unmapFile();                                   ///< @brief 平台相关的解除映射
+};
+
+} // namespace engine::resource
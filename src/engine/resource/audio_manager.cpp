@@ -1,11 +1,15 @@
 #include "audio_manager.h"
+#include "cooked_audio.h"
 #include <spdlog/spdlog.h>
+#include "../debug/log.h"
+#include "../debug/alloc_counter.h"
+#include <filesystem>
 #include <stdexcept>
 
 namespace engine::resource {
 
 // 构造函数：初始化SDL_mixer
-AudioManager::AudioManager() {
+AudioManager::AudioManager(const AssetPack& asset_pack) : asset_pack_(asset_pack) {
     // 使用所需的格式初始化SDL_mixer（推荐OGG、MP3）
     MIX_InitFlags flags = MIX_INIT_OGG | MIX_INIT_MP3;
     if ((Mix_Init(flags) & flags) != flags) {
@@ -17,11 +21,26 @@ AudioManager::AudioManager() {
         Mix_Quit(); // 如果OpenAudio失败，先清理Mix_Init，再抛出异常
         throw std::runtime_error("AudioManager 错误: Mix_OpenAudio 失败: " + std::string(SDL_GetError()));
     }
+    // 记录混音器实际使用的格式，预处理音效只有与之一致时才能直接使用
+    Mix_QuerySpec(&device_frequency_, &device_format_, &device_channels_);
+    spdlog::debug("混音器格式: {} Hz, 格式 0x{:x}, {} 声道", device_frequency_, static_cast<unsigned>(device_format_), device_channels_);
+
+    music_loader_ = std::thread(&AudioManager::musicLoaderLoop, this);
     spdlog::trace("AudioManager 构造成功。");
 }
 
 AudioManager::~AudioManager()
 {
+    // 先停止加载线程，再丢弃它已读取但尚未打开的数据（此时还没有对应的 Mix_Music）
+    {
+        std::lock_guard lock(music_mutex_);
+        stop_loader_ = true;
+        music_requests_.clear();
+    }
+    music_cv_.notify_one();
+    if (music_loader_.joinable()) music_loader_.join();
+    music_loaded_.clear();
+
     // 立即停止所有音频播放
     Mix_HaltChannel(-1); // 停止所有音效
     Mix_HaltMusic();     // 停止音乐
@@ -40,39 +59,87 @@ AudioManager::~AudioManager()
 
 // --- 音效管理 ---
 Mix_Chunk* AudioManager::loadSound(std::string_view file_path) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
     // 首先检查缓存
-    auto it = sounds_.find(std::string(file_path));
+    auto it = sounds_.find(file_path);
     if (it != sounds_.end()) {
-        return it->second.get();
+        return it->second.chunk_.get();
     }
 
     // 加载音效块
     spdlog::debug("加载音效: {}", file_path);
-    Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.data());
-    if (!raw_chunk) {
-        spdlog::error("加载音效失败: '{}': {}", file_path, SDL_GetError());
-        return nullptr;
-    }
+    Mix_Chunk* raw_chunk = decodeSound(file_path);
+    if (!raw_chunk) return nullptr;
 
     // 使用unique_ptr存储在缓存中
-    sounds_.emplace(file_path, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>(raw_chunk));
     spdlog::debug("成功加载并缓存音效: {}", file_path);
+    return insertSound(file_path, raw_chunk);
+}
+
+Mix_Chunk* AudioManager::decodeSound(std::string_view file_path) const {
+    // 快速路径：预处理的设备格式 PCM，直接拷贝即可
+    if (Mix_Chunk* cooked_chunk = loadCookedSound(file_path)) return cooked_chunk;
+
+    // 慢速路径：解码原始文件并转换为设备格式
+    SDL_IOStream* io = asset_pack_.open(file_path);
+    Mix_Chunk* raw_chunk = io ? Mix_LoadWAV_IO(io, true) : nullptr;
+    if (!raw_chunk) {
+        spdlog::error("加载音效失败: '{}': {}", file_path, SDL_GetError());
+    }
     return raw_chunk;
 }
 
+Mix_Chunk* AudioManager::loadCookedSound(std::string_view file_path) const {
+    const std::string cooked_path = cooked::cookedSoundPath(file_path);
+    if (!asset_pack_.contains(cooked_path) && !std::filesystem::exists(cooked_path)) return nullptr;
+    SDL_IOStream* io = asset_pack_.open(cooked_path);
+    if (!io) return nullptr;
+
+    Mix_Chunk* chunk = nullptr;
+    cooked::CookedAudioHeader header;
+    const Sint64 io_size = SDL_GetIOSize(io);
+    if (SDL_ReadIO(io, &header, sizeof(header)) != sizeof(header) ||
+        header.magic_ != cooked::COOKED_AUDIO_MAGIC || header.version_ != cooked::COOKED_AUDIO_VERSION ||
+        io_size < 0 || header.data_size_ > static_cast<std::uint64_t>(io_size) - sizeof(header)) {
+        spdlog::warn("预处理音效 '{}' 无效，改为解码原始文件。", cooked_path);
+    } else if (header.frequency_ != device_frequency_ || header.format_ != device_format_ ||
+               header.channels_ != device_channels_) {
+        spdlog::debug("预处理音效 '{}' 的格式 ({} Hz, {} 声道) 与混音器不一致，改为解码原始文件。",
+                      cooked_path, header.frequency_, header.channels_);
+    } else {
+        const auto size = static_cast<std::size_t>(header.data_size_);
+        auto* buffer = static_cast<Uint8*>(SDL_malloc(size));
+        if (buffer && SDL_ReadIO(io, buffer, size) == size) {
+            chunk = Mix_QuickLoad_RAW(buffer, static_cast<Uint32>(size));
+        }
+        if (chunk) {
+            chunk->allocated = 1;   // 由 Mix_FreeChunk 负责 SDL_free(buffer)
+        } else {
+            SDL_free(buffer);
+        }
+    }
+    SDL_CloseIO(io);
+    return chunk;
+}
+
 Mix_Chunk* AudioManager::getSound(std::string_view file_path) {
-    auto it = sounds_.find(std::string(file_path));
+    auto it = sounds_.find(file_path);
     if (it != sounds_.end()) {
-        return it->second.get();
+        ++sound_stats_.hits_;
+        sound_lru_.splice(sound_lru_.begin(), sound_lru_, it->second.lru_it_);  // 移到表头（最近使用）
+        return it->second.chunk_.get();
     }
-    spdlog::warn("音效 '{}' 未找到缓存，尝试加载。", file_path);
+    ++sound_stats_.misses_;
+    ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "音效 '{}' 未找到缓存，尝试加载。", file_path);
     return loadSound(file_path);
 }
 
 void AudioManager::unloadSound(std::string_view file_path) {
-    auto it = sounds_.find(std::string(file_path));
+    auto it = sounds_.find(file_path);
     if (it != sounds_.end()) {
         spdlog::debug("卸载音效: {}", file_path);
+        sound_stats_.bytes_ -= it->second.bytes_;
+        sound_lru_.erase(it->second.lru_it_);
         sounds_.erase(it);      // unique_ptr处理Mix_FreeChunk
     } else {
         spdlog::warn("尝试卸载不存在的音效: {}", file_path);
@@ -83,42 +150,124 @@ void AudioManager::clearSounds() {
     if (!sounds_.empty()) {
         spdlog::debug("正在清除所有 {} 个缓存的音效。", sounds_.size());
         sounds_.clear(); // unique_ptr处理删除
+        sound_lru_.clear();
+        sound_stats_.bytes_ = 0;
     }
 }
 
+Mix_Chunk* AudioManager::addSound(std::string_view file_path, Mix_Chunk* chunk) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
+    auto it = sounds_.find(file_path);
+    if (it != sounds_.end()) {      // 已缓存，丢弃重复的结果
+        Mix_FreeChunk(chunk);
+        return it->second.chunk_.get();
+    }
+    spdlog::debug("成功缓存预加载的音效: {}", file_path);
+    return insertSound(file_path, chunk);
+}
+
+bool AudioManager::hasSound(std::string_view file_path) const {
+    return sounds_.contains(file_path);
+}
+
+void AudioManager::setSoundBudget(std::size_t budget_bytes) {
+    sound_stats_.budget_bytes_ = budget_bytes;
+    evictSoundsToBudget();
+}
+
+void AudioManager::pinSound(std::string_view file_path) {
+    auto it = sounds_.find(file_path);
+    if (it != sounds_.end()) {
+        ++it->second.pin_count_;
+    } else {
+        spdlog::warn("尝试固定不存在的音效: {}", file_path);
+    }
+}
+
+void AudioManager::unpinSound(std::string_view file_path) {
+    auto it = sounds_.find(file_path);
+    if (it != sounds_.end() && it->second.pin_count_ > 0) {
+        --it->second.pin_count_;
+    }
+}
+
+Mix_Chunk* AudioManager::insertSound(std::string_view file_path, Mix_Chunk* chunk) {
+    sound_lru_.emplace_front(file_path);
+    SoundEntry entry;
+    entry.chunk_.reset(chunk);
+    entry.bytes_ = chunk->alen;
+    entry.lru_it_ = sound_lru_.begin();
+    sound_stats_.bytes_ += entry.bytes_;
+    sounds_.emplace(file_path, std::move(entry));
+
+    evictSoundsToBudget();
+    return chunk;
+}
+
+void AudioManager::evictSoundsToBudget() {
+    if (sound_stats_.budget_bytes_ == 0) return;
+
+    // 从最久未使用的一端开始淘汰；表头（刚加入/最近使用）保留，正在播放的音效跳过
+    auto it = sound_lru_.end();
+    while (sound_stats_.bytes_ > sound_stats_.budget_bytes_ && it != sound_lru_.begin()) {
+        --it;
+        if (it == sound_lru_.begin()) break;
+        auto entry_it = sounds_.find(*it);
+        if (entry_it->second.pin_count_ > 0 || isChunkPlaying(entry_it->second.chunk_.get())) continue;
+
+        spdlog::debug("音效缓存超出预算，淘汰: {}", *it);
+        sound_stats_.bytes_ -= entry_it->second.bytes_;
+        ++sound_stats_.evictions_;
+        sounds_.erase(entry_it);
+        it = sound_lru_.erase(it);
+    }
+}
+
+bool AudioManager::isChunkPlaying(const Mix_Chunk* chunk) const {
+    int channels = Mix_AllocateChannels(-1);    // 参数 -1 表示查询当前通道数
+    for (int channel = 0; channel < channels; ++channel) {
+        if (Mix_Playing(channel) && Mix_GetChunk(channel) == chunk) return true;
+    }
+    return false;
+}
+
 // --- 音乐管理 ---
 Mix_Music* AudioManager::loadMusic(std::string_view file_path) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
     // 首先检查缓存
-    auto it = music_.find(std::string(file_path));
+    auto it = music_.find(file_path);
     if (it != music_.end()) {
-        return it->second.get();
+        return it->second.music_.get();
     }
 
     // 加载音乐
     spdlog::debug("加载音乐: {}", file_path);
-    Mix_Music* raw_music = Mix_LoadMUS(file_path.data());
+    SDL_IOStream* io = asset_pack_.open(file_path);
+    Mix_Music* raw_music = io ? Mix_LoadMUS_IO(io, true) : nullptr;
     if (!raw_music) {
         spdlog::error("加载音乐失败: '{}': {}", file_path, SDL_GetError());
         return nullptr;
     }
 
     // 使用unique_ptr存储在缓存中
-    music_.emplace(file_path, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>(raw_music));
+    music_[std::string(file_path)].music_.reset(raw_music);
     spdlog::debug("成功加载并缓存音乐: {}", file_path);
     return raw_music;
 }
 
 Mix_Music* AudioManager::getMusic(std::string_view file_path) {
-    auto it = music_.find(std::string(file_path));
+    auto it = music_.find(file_path);
     if (it != music_.end()) {
-        return it->second.get();
+        ++music_stats_.hits_;
+        return it->second.music_.get();
     }
-    spdlog::warn("音乐 '{}' 未找到缓存，尝试加载。", file_path);
+    ++music_stats_.misses_;
+    ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "音乐 '{}' 未找到缓存，尝试加载。", file_path);
     return loadMusic(file_path);
 }
 
 void AudioManager::unloadMusic(std::string_view file_path) {
-    auto it = music_.find(std::string(file_path));
+    auto it = music_.find(file_path);
     if (it != music_.end()) {
         spdlog::debug("卸载音乐: {}", file_path);
         music_.erase(it); // unique_ptr处理Mix_FreeMusic
@@ -140,4 +289,110 @@ void AudioManager::clearAudio()
     clearMusic();
 }
 
+// --- 后台音乐加载 ---
+void AudioManager::requestMusic(std::string_view file_path) {
+    if (music_.contains(file_path) || music_pending_.contains(file_path)) return;
+    std::string path(file_path);
+
+    music_pending_.insert(path);
+    {
+        std::lock_guard lock(music_mutex_);
+        music_requests_.push_back(std::move(path));
+    }
+    music_cv_.notify_one();
+    spdlog::debug("请求后台加载音乐: {}", file_path);
+}
+
+Mix_Music* AudioManager::tryGetMusic(std::string_view file_path) {
+    pollMusicLoads();
+    auto it = music_.find(file_path);
+    if (it != music_.end()) {
+        ++music_stats_.hits_;
+        return it->second.music_.get();
+    }
+    ++music_stats_.misses_;
+    requestMusic(file_path);
+    return nullptr;
+}
+
+bool AudioManager::isMusicPending(std::string_view file_path) const {
+    return music_pending_.contains(file_path);
+}
+
+bool AudioManager::hasMusic(std::string_view file_path) const {
+    return music_.contains(file_path);
+}
+
+void AudioManager::pollMusicLoads() {
+    std::vector<LoadedMusic> loaded;
+    {
+        std::lock_guard lock(music_mutex_);
+        if (music_loaded_.empty()) return;
+        loaded.swap(music_loaded_);
+    }
+
+    for (auto& result : loaded) {
+        music_pending_.erase(result.path_);
+        if (!result.packed_ && !result.data_) continue;     // 读取失败已在加载线程中记录
+        // 期间可能已被同步加载，此时丢弃重复的结果
+        auto [it, inserted] = music_.try_emplace(result.path_);
+        if (!inserted) continue;
+
+        // 在主线程创建解码器。Mix_Music 会持续从 IO 读取，所以从缓存条目（节点地址稳定）中的数据打开
+        auto& entry = it->second;
+        SDL_IOStream* io = nullptr;
+        if (result.packed_) {
+            io = asset_pack_.open(result.path_);
+        } else {
+            entry.data_ = std::move(*result.data_);
+            io = SDL_IOFromConstMem(entry.data_.data(), entry.data_.size());
+        }
+        entry.music_.reset(io ? Mix_LoadMUS_IO(io, true) : nullptr);
+        if (!entry.music_) {
+            spdlog::error("后台加载音乐失败: '{}': {}", result.path_, SDL_GetError());
+            music_.erase(it);
+            continue;
+        }
+        spdlog::debug("后台加载音乐完成: {}", result.path_);
+    }
+}
+
+void AudioManager::musicLoaderLoop() {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::AUDIO);
+    while (true) {
+        LoadedMusic result;
+        {
+            std::unique_lock lock(music_mutex_);
+            music_cv_.wait(lock, [this] { return stop_loader_ || !music_requests_.empty(); });
+            if (stop_loader_) return;
+            result.path_ = std::move(music_requests_.front());
+            music_requests_.pop_front();
+        }
+
+        // 只做文件读取，不调用任何 SDL_mixer 函数；资源包已内存映射，无需在这里复制
+        result.packed_ = asset_pack_.contains(result.path_);
+        if (!result.packed_) {
+            result.data_ = asset_pack_.readText(result.path_);
+            if (!result.data_) {
+                spdlog::error("后台读取音乐失败: '{}'", result.path_);
+            }
+        }
+
+        std::lock_guard lock(music_mutex_);
+        music_loaded_.push_back(std::move(result));
+    }
+}
+
+CacheStats AudioManager::getSoundStats() const {
+    CacheStats stats = sound_stats_;
+    stats.entries_ = sounds_.size();
+    return stats;
+}
+
+CacheStats AudioManager::getMusicStats() const {
+    CacheStats stats = music_stats_;
+    stats.entries_ = music_.size();
+    return stats;
+}
+
 } // namespace engine::resource
@@ -4,8 +4,21 @@
 #include <string>       // 用于 std::string
 #include <string_view> // 用于 std::string_view
 #include <unordered_map> // 用于 std::unordered_map
+#include <unordered_set>
+#include <cstddef>
+#include <list>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <SDL3_mixer/SDL_mixer.h> // SDL_mixer 主头文件
+#include "cache_stats.h"
+#include "asset_pack.h"
+#include "../utils/string_hash.h"
 
 namespace engine::resource {
 
@@ -13,6 +26,10 @@ namespace engine::resource {
  * @brief 管理 SDL_mixer 音效 (Mix_Chunk) 和音乐 (Mix_Music)。
  *
  * 提供音频资源的加载和缓存功能。构造失败时会抛出异常。
+ * 音乐可以通过后台线程异步加载：加载线程只负责读取文件数据（耗时的磁盘 I/O），
+ * Mix_LoadMUS_IO 由主线程在 pollMusicLoads() 中调用（SDL_mixer 不保证解码器创建是线程安全的，
+ * 且只解析文件头，开销很小）。资源包中的音乐直接从内存映射流式解码，无需后台读取。
+ * 音效优先读取预处理好的设备格式 PCM（见 cooked_audio.h），免去解码与重采样。
  * 仅供 ResourceManager 内部使用。
  */
 class AudioManager final{
@@ -37,17 +54,54 @@ private:
         }
     };
 
-    // 音效存储 (文件路径 -> Mix_Chunk)
-    std::unordered_map<std::string, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>> sounds_;
-    // 音乐存储 (文件路径 -> Mix_Music)
-    std::unordered_map<std::string, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>> music_;
+    /// @brief 音效缓存条目：音效及其内存占用、固定计数和在 LRU 链表中的位置
+    struct SoundEntry {
+        std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter> chunk_;
+        std::size_t bytes_ = 0;                         ///< @brief 解码后的 PCM 大小 (Mix_Chunk::alen)
+        int pin_count_ = 0;                             ///< @brief 固定计数，大于 0 时不会被淘汰
+        std::list<std::string>::iterator lru_it_;       ///< @brief 在 sound_lru_ 中的位置
+    };
+
+    // 音效存储 (文件路径 -> 音效条目)
+    std::unordered_map<std::string, SoundEntry, engine::utils::StringHash, std::equal_to<>> sounds_;
+    std::list<std::string> sound_lru_;  ///< @brief 音效最近使用顺序，表头为最近使用
+    /// @brief 音乐缓存条目：Mix_Music 播放时从 IO 流式解码，后台读入内存的文件数据需与之同生命周期
+    struct MusicEntry {
+        std::unique_ptr<Mix_Music, SDLMixMusicDeleter> music_;
+        std::string data_;                              ///< @brief 后台读入的文件数据（从磁盘或资源包直接打开时为空）
+    };
+    /// @brief 后台加载线程的结果：已读入的文件数据，由主线程打开
+    struct LoadedMusic {
+        std::string path_;
+        std::optional<std::string> data_;               ///< @brief 文件数据，读取失败时为空
+        bool packed_ = false;                           ///< @brief 位于资源包中（内存映射，主线程直接打开，不复制）
+    };
+    // 音乐存储 (文件路径 -> 音乐条目)
+    std::unordered_map<std::string, MusicEntry, engine::utils::StringHash, std::equal_to<>> music_;
+
+    const AssetPack& asset_pack_;   ///< @brief 资源包（文件读取入口，挂载后只读，加载线程可安全使用）
+    int device_frequency_ = 0;      ///< @brief 混音器采样率（构造后不变，预处理音效需与之一致）
+    SDL_AudioFormat device_format_ = SDL_AUDIO_UNKNOWN;     ///< @brief 混音器采样格式
+    int device_channels_ = 0;       ///< @brief 混音器声道数
+    CacheStats sound_stats_;    ///< @brief 音效缓存命中统计
+    CacheStats music_stats_;    ///< @brief 音乐缓存命中统计
+
+    // --- 后台音乐加载 ---
+    std::thread music_loader_;                                      ///< @brief 音乐加载线程
+    std::mutex music_mutex_;                                        ///< @brief 保护下面两个队列与 stop_loader_
+    std::condition_variable music_cv_;                              ///< @brief 通知加载线程有新请求
+    std::deque<std::string> music_requests_;                        ///< @brief 待加载的音乐路径
+    std::vector<LoadedMusic> music_loaded_;                         ///< @brief 已读取、等待主线程打开的音乐
+    bool stop_loader_ = false;                                      ///< @brief 通知加载线程退出
+    std::unordered_set<std::string, engine::utils::StringHash, std::equal_to<>> music_pending_;                 ///< @brief 已请求但尚未接收的路径（仅主线程访问）
 
 public:
     /**
      * @brief 构造函数。初始化 SDL_mixer 并打开音频设备。
+     * @param asset_pack 资源包，所有文件经由它读取。
      * @throws std::runtime_error 如果 SDL_mixer 初始化或打开音频设备失败。
      */
-    AudioManager();
+    explicit AudioManager(const AssetPack& asset_pack);
 
     ~AudioManager();            ///< @brief 需要手动添加析构函数，清理资源并关闭 SDL_mixer。
 
@@ -60,16 +114,42 @@ public:
 private:  // 仅供 ResourceManager 访问的方法
 
     Mix_Chunk* loadSound(std::string_view file_path);     ///< @brief 从文件路径加载音效
+    /**
+     * @brief 解码音效但不缓存：优先读取格式匹配的预处理 PCM，否则解码原始文件。
+     * 只读取构造后不变的成员，可在工作线程中调用。
+     * @return 新的 Mix_Chunk（调用者获得所有权），失败返回 nullptr。
+     */
+    Mix_Chunk* decodeSound(std::string_view file_path) const;
     Mix_Chunk* getSound(std::string_view file_path);      ///< @brief 尝试获取已加载音效的指针，如果未加载则尝试加载
     void unloadSound(std::string_view file_path);         ///< @brief 卸载指定的音效资源
     void clearSounds();                                      ///< @brief 清空所有音效资源
+    Mix_Chunk* addSound(std::string_view file_path, Mix_Chunk* chunk);  ///< @brief 缓存已在其他线程解码的音效（获取所有权）
+    bool hasSound(std::string_view file_path) const;         ///< @brief 音效是否已缓存（不计入命中统计）
+    void setSoundBudget(std::size_t budget_bytes);           ///< @brief 设置音效内存预算（字节，0 表示不限制），超出时按 LRU 淘汰
+    void pinSound(std::string_view file_path);               ///< @brief 固定音效（不会被淘汰），可重复调用
+    void unpinSound(std::string_view file_path);             ///< @brief 取消一次固定
 
     Mix_Music* loadMusic(std::string_view file_path);     ///< @brief 从文件路径加载音乐
     Mix_Music* getMusic(std::string_view file_path);      ///< @brief 尝试获取已加载音乐的指针，如果未加载则尝试加载
     void unloadMusic(std::string_view file_path);         ///< @brief 卸载指定的音乐资源
     void clearMusic();                                      ///< @brief 清空所有音乐资源
 
+    void requestMusic(std::string_view file_path);          ///< @brief 请求后台加载音乐（已缓存或已在加载中则忽略）
+    Mix_Music* tryGetMusic(std::string_view file_path);     ///< @brief 非阻塞获取音乐：未就绪时请求后台加载并返回 nullptr
+    bool isMusicPending(std::string_view file_path) const;  ///< @brief 音乐是否仍在后台加载中
+    bool hasMusic(std::string_view file_path) const;        ///< @brief 音乐是否已缓存（不计入命中统计）
+    void pollMusicLoads();                                  ///< @brief 打开后台已读取完成的音乐并放入缓存（主线程调用）
+
     void clearAudio();                                      ///< @brief 清空所有音频资源
+
+    CacheStats getSoundStats() const;                       ///< @brief 获取音效缓存统计
+    CacheStats getMusicStats() const;                       ///< @brief 获取音乐缓存统计
+
+    void musicLoaderLoop();                                 ///< @brief 加载线程主循环
+    Mix_Chunk* loadCookedSound(std::string_view file_path) const;  ///< @brief 读取预处理 PCM，不存在或格式不匹配时返回 nullptr
+    Mix_Chunk* insertSound(std::string_view file_path, Mix_Chunk* chunk);   ///< @brief 记录新音效并按预算淘汰
+    void evictSoundsToBudget();                             ///< @brief 从 LRU 尾部淘汰未固定且未在播放的音效
+    bool isChunkPlaying(const Mix_Chunk* chunk) const;      ///< @brief 音效是否正在某个通道上播放
 };
 
 } // namespace engine::resource
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>      // 用于 std::size_t
+
+namespace engine::resource {
+
+/**
+ * @brief 资源缓存的统计数据，供调试面板显示。
+ *
+ * 命中/未命中只在 getXxx() 查询时计数（显式的 loadXxx() 预加载不计入）。
+ */
+struct CacheStats {
+    std::size_t entries_ = 0;       ///< @brief 当前缓存的条目数量
+    std::size_t hits_ = 0;          ///< @brief 查询命中次数
+    std::size_t misses_ = 0;        ///< @brief 查询未命中次数（随后会尝试加载）
+    std::size_t bytes_ = 0;         ///< @brief 当前缓存占用的内存（估算，字节）
+    std::size_t budget_bytes_ = 0;  ///< @brief 内存预算（字节，0 表示不限制）
+    std::size_t evictions_ = 0;     ///< @brief 因超出预算被淘汰的条目数量
+
+    /// @brief 命中率 (0~1)，无查询时返回 0
+    float hitRate() const {
+        std::size_t total = hits_ + misses_;
+        return total == 0 ? 0.0f : static_cast<float>(hits_) / static_cast<float>(total);
+    }
+};
+
+} // namespace engine::resource
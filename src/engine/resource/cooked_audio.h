@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief 预处理音效 (.pcm) 文件格式，由音频预处理工具 (tools/audio_cooker) 与运行时 AudioManager 共用。
+ *
+ * 布局（小端序）：[CookedAudioHeader][PCM 数据 data_size_ 字节]
+ * PCM 数据已是混音器设备格式（采样率、采样格式、声道数与文件头一致），
+ * 格式匹配时运行时直接拷贝为 Mix_Chunk，无需解码和重采样；不匹配时回退到原始文件。
+ */
+namespace engine::resource::cooked {
+
+constexpr std::uint32_t COOKED_AUDIO_MAGIC = 0x4350574D;    ///< @brief "MWPC"
+constexpr std::uint32_t COOKED_AUDIO_VERSION = 1;
+constexpr std::string_view ASSETS_PREFIX = "assets/";
+constexpr std::string_view COOKED_PREFIX = "assets/cooked/";
+
+/// @brief 文件头
+struct CookedAudioHeader {
+    std::uint32_t magic_ = COOKED_AUDIO_MAGIC;
+    std::uint32_t version_ = COOKED_AUDIO_VERSION;
+    std::int32_t frequency_ = 0;        ///< @brief 采样率
+    std::uint32_t format_ = 0;          ///< @brief 采样格式 (SDL_AudioFormat)
+    std::int32_t channels_ = 0;         ///< @brief 声道数
+    std::uint32_t reserved_ = 0;
+    std::uint64_t data_size_ = 0;       ///< @brief PCM 数据字节数
+};
+static_assert(sizeof(CookedAudioHeader) == 32, "CookedAudioHeader 的布局必须固定");
+
+/**
+ * @brief 原始音效路径对应的预处理文件路径。
+ * 例如 "assets/audio/Bow Attack.wav" -> "assets/cooked/audio/Bow Attack.wav.pcm"
+ */
+inline std::string cookedSoundPath(std::string_view sound_path) {
+    if (sound_path.starts_with(ASSETS_PREFIX)) sound_path.remove_prefix(ASSETS_PREFIX.size());
+    std::string path(COOKED_PREFIX);
+    path.append(sound_path).append(".pcm");
+    return path;
+}
+
+} // namespace engine::resource::cooked
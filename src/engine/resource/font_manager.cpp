@@ -1,10 +1,12 @@
 #include "font_manager.h"
 #include <spdlog/spdlog.h>
+#include "../debug/log.h"
+#include "../debug/alloc_counter.h"
 #include <stdexcept>
 
 namespace engine::resource {
 
-FontManager::FontManager() {
+FontManager::FontManager(const AssetPack& asset_pack) : asset_pack_(asset_pack) {
     if (!TTF_WasInit() && !TTF_Init()) {
         throw std::runtime_error("FontManager 错误: TTF_Init 失败：" + std::string(SDL_GetError()));
     }
@@ -21,49 +23,48 @@ FontManager::~FontManager() {
 }
 
 TTF_Font* FontManager::loadFont(std::string_view file_path, int point_size) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::RESOURCE);
     // 检查点大小是否有效
     if (point_size <= 0) {
         spdlog::error("无法加载字体 '{}'：无效的点大小 {}。", file_path, point_size);
         return nullptr;
     }
 
-    // 创建映射表的键
-    FontKey key = {std::string(file_path), point_size};
-
     // 首先检查缓存
-    auto it = fonts_.find(key);
+    auto it = fonts_.find(FontKeyView{file_path, point_size});
     if (it != fonts_.end()) {
         return it->second.get();
     }
 
     // 缓存中不存在，则加载字体
     spdlog::debug("正在加载字体：{} ({}pt)", file_path, point_size);
-    TTF_Font* raw_font = TTF_OpenFont(file_path.data(), point_size);
+    SDL_IOStream* io = asset_pack_.open(file_path);
+    TTF_Font* raw_font = io ? TTF_OpenFontIO(io, true, static_cast<float>(point_size)) : nullptr;
     if (!raw_font) {
         spdlog::error("加载字体 '{}' ({}pt) 失败：{}", file_path, point_size, SDL_GetError());
         return nullptr;
     }
 
     // 使用 unique_ptr 存储到缓存中
-    fonts_.emplace(key, std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
+    fonts_.emplace(FontKey{std::string(file_path), point_size}, std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
     spdlog::debug("成功加载并缓存字体：{} ({}pt)", file_path, point_size);
     return raw_font;
 }
 
 TTF_Font* FontManager::getFont(std::string_view file_path, int point_size) {
-    FontKey key = {std::string(file_path), point_size};
-    auto it = fonts_.find(key);
+    auto it = fonts_.find(FontKeyView{file_path, point_size});
     if (it != fonts_.end()) {
+        ++stats_.hits_;
         return it->second.get();
     }
 
-    spdlog::warn("字体 '{}' ({}pt) 不在缓存中，尝试加载。", file_path, point_size);
+    ++stats_.misses_;
+    ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "字体 '{}' ({}pt) 不在缓存中，尝试加载。", file_path, point_size);
     return loadFont(file_path, point_size);
 }
 
 void FontManager::unloadFont(std::string_view file_path, int point_size) {
-    FontKey key = {std::string(file_path), point_size};
-    auto it = fonts_.find(key);
+    auto it = fonts_.find(FontKeyView{file_path, point_size});
     if (it != fonts_.end()) {
         spdlog::debug("卸载字体：{} ({}pt)", file_path, point_size);
         fonts_.erase(it);       // unique_ptr 会处理 TTF_CloseFont
@@ -79,4 +80,14 @@ void FontManager::clearFonts() {
     }
 }
 
+bool FontManager::hasFont(std::string_view file_path, int point_size) const {
+    return fonts_.contains(FontKeyView{file_path, point_size});
+}
+
+CacheStats FontManager::getStats() const {
+    CacheStats stats = stats_;
+    stats.entries_ = fonts_.size();
+    return stats;
+}
+
 } // namespace engine::resource
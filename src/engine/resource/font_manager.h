@@ -8,19 +8,33 @@
 #include <functional>   // 用于 std::hash
 
 #include <SDL3_ttf/SDL_ttf.h> // SDL_ttf 主头文件
+#include "cache_stats.h"
+#include "asset_pack.h"
 
 namespace engine::resource {
 
 // 定义字体键类型（路径 + 大小）
 using FontKey = std::pair<std::string, int>;        // std::pair 是标准库中的一个类模板，用于将两个值组合成一个单元
 
+using FontKeyView = std::pair<std::string_view, int>;   // 查找用的键，不需要构造 std::string
+
 // FontKey 的自定义哈希函数（std::pair<std::string, int>），用于 std::unordered_map
+// 透明哈希：也接受 FontKeyView，与 FontKeyEqual 一起使查找时无需构造临时的 std::string
 struct FontKeyHash {
-    std::size_t operator()(const FontKey& key) const {
-        std::hash<std::string> string_hasher;
+    using is_transparent = void;
+    std::size_t operator()(const FontKeyView& key) const {
+        std::hash<std::string_view> string_hasher;
         std::hash<int> int_hasher;
         return string_hasher(key.first) ^ int_hasher(key.second);       // 异或运算符 ^ 按位计算，每一位的两个值不同为1，相同为0，这是合并两个哈希值的简单方法
     }
+    std::size_t operator()(const FontKey& key) const { return (*this)(FontKeyView{key.first, key.second}); }
+};
+
+// FontKey / FontKeyView 之间的相等比较
+struct FontKeyEqual {
+    using is_transparent = void;
+    template<typename L, typename R>
+    bool operator()(const L& lhs, const R& rhs) const { return lhs.second == rhs.second && lhs.first == rhs.first; }
 };
 
 /**
@@ -45,14 +59,17 @@ private:
     // 字体存储（FontKey -> TTF_Font）。  
     // unordered_map 的键需要能转换为哈希值，对于基础数据类型，系统会自动转换
     // 但是对于对于自定义类型（系统无法自动转化），则需要提供自定义哈希函数（第三个模版参数）
-    std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash> fonts_;
+    std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash, FontKeyEqual> fonts_;
+    const AssetPack& asset_pack_;   ///< @brief 资源包（文件读取入口）
+    CacheStats stats_;          ///< @brief 缓存命中统计
 
 public:
     /**
      * @brief 构造函数。初始化 SDL_ttf。
+     * @param asset_pack 资源包，所有文件经由它读取。
      * @throws std::runtime_error 如果 SDL_ttf 初始化失败。
      */
-    FontManager();
+    explicit FontManager(const AssetPack& asset_pack);
     
     ~FontManager();            ///< @brief 需要手动添加析构函数，清理资源并关闭 SDL_ttf。
 
@@ -68,6 +85,8 @@ private: // 仅由 ResourceManager（和内部）访问的方法
     TTF_Font* getFont(std::string_view file_path, int point_size);      ///< @brief 尝试获取已加载字体的指针，如果未加载则尝试加载
     void unloadFont(std::string_view file_path, int point_size);        ///< @brief 卸载特定字体（通过路径和大小标识）
     void clearFonts();                                                    ///< @brief 清空所有缓存的字体
+    bool hasFont(std::string_view file_path, int point_size) const;       ///< @brief 字体是否已缓存（不计入命中统计）
+    CacheStats getStats() const;                                          ///< @brief 获取字体缓存统计
 };
 
 } // namespace engine::resource
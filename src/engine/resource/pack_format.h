@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief 资源包 (.pak) 文件格式，由打包工具 (tools/asset_packer) 与运行时 AssetPack 共用。
+ *
+ * 布局（小端序）：
+ *   [PackHeader]
+ *   [文件数据 ...]                  每个文件按 PACK_ALIGNMENT 对齐
+ *   [目录: entry_count 个条目]       每个条目: u64 路径哈希, u64 偏移, u64 大小, u32 路径长度, 路径字节
+ * 路径为相对于工作目录的正斜杠路径，如 "assets/textures/UI/frame.png"。
+ */
+namespace engine::resource::pack {
+
+constexpr std::uint32_t PACK_MAGIC = 0x4B50574D;    ///< @brief "MWPK"
+constexpr std::uint32_t PACK_VERSION = 1;
+constexpr std::uint64_t PACK_ALIGNMENT = 16;
+
+/// @brief 文件头
+struct PackHeader {
+    std::uint32_t magic_ = PACK_MAGIC;
+    std::uint32_t version_ = PACK_VERSION;
+    std::uint32_t entry_count_ = 0;
+    std::uint32_t reserved_ = 0;
+    std::uint64_t toc_offset_ = 0;      ///< @brief 目录在文件中的偏移
+};
+static_assert(sizeof(PackHeader) == 24, "PackHeader 的布局必须固定");
+
+/// @brief 路径哈希 (FNV-1a 64位)
+constexpr std::uint64_t hashPath(std::string_view path) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace engine::resource::pack
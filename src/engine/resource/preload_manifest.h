@@ -0,0 +1,44 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace engine::resource {
+
+/**
+ * @brief 预加载清单：一个关卡（或场景）需要的全部资源路径。
+ *
+ * 由游戏层根据关卡配置、敌人数据、存档等生成，交给 Preloader 并行加载。
+ * 路径必须与运行时请求资源时使用的键完全一致，否则仍会出现缓存未命中。
+ */
+struct PreloadManifest {
+    std::vector<std::string> textures_;                 ///< @brief 纹理路径
+    std::vector<std::string> sounds_;                   ///< @brief 音效路径
+    std::vector<std::string> music_;                    ///< @brief 音乐路径（交给后台音乐加载线程）
+    std::vector<std::pair<std::string, int>> fonts_;    ///< @brief 字体路径与字号
+
+    void addTexture(std::string_view path) { if (!path.empty()) textures_.emplace_back(path); }
+    void addSound(std::string_view path) { if (!path.empty()) sounds_.emplace_back(path); }
+    void addMusic(std::string_view path) { if (!path.empty()) music_.emplace_back(path); }
+    void addFont(std::string_view path, int point_size) { if (!path.empty()) fonts_.emplace_back(path, point_size); }
+
+    /// @brief 排序并去除重复条目
+    void removeDuplicates() {
+        auto unique = [](auto& items) {
+            std::sort(items.begin(), items.end());
+            items.erase(std::unique(items.begin(), items.end()), items.end());
+        };
+        unique(textures_);
+        unique(sounds_);
+        unique(music_);
+        unique(fonts_);
+    }
+
+    /// @brief 条目总数
+    std::size_t size() const { return textures_.size() + sounds_.size() + music_.size() + fonts_.size(); }
+};
+
+} // namespace engine::resource
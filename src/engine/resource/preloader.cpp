@@ -0,0 +1,180 @@
+#include "preloader.h"
+#include "resource_manager.h"
+#include "../debug/alloc_counter.h"
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace engine::resource {
+
+Preloader::Preloader(ResourceManager& resource_manager, PreloadManifest manifest, unsigned int thread_count)
+    : resource_manager_(resource_manager), manifest_(std::move(manifest))
+{
+    manifest_.removeDuplicates();
+    total_ = manifest_.size();
+
+    // 已缓存的资源直接计为完成，其余的交给工作线程
+    for (const auto& path : manifest_.textures_) {
+        if (resource_manager_.hasTexture(path)) ++completed_;
+        else jobs_.push_back({Decoded::Type::Texture, path});
+    }
+    for (const auto& path : manifest_.sounds_) {
+        if (resource_manager_.hasSound(path)) ++completed_;
+        else jobs_.push_back({Decoded::Type::Sound, path});
+    }
+    for (const auto& path : manifest_.music_) {
+        if (!resource_manager_.hasMusic(path) && !resource_manager_.isMusicPending(path)) loaded_.addMusic(path);
+        resource_manager_.prefetchMusic(path);
+        music_waiting_.push_back(path);
+    }
+
+    if (thread_count == 0) {
+        unsigned int hardware_threads = std::thread::hardware_concurrency();
+        thread_count = hardware_threads > 1 ? hardware_threads - 1 : 1;     // 给主线程留一个核心
+    }
+    thread_count = std::min<unsigned int>(thread_count, static_cast<unsigned int>(jobs_.size()));
+    for (unsigned int i = 0; i < thread_count; ++i) {
+        workers_.emplace_back(&Preloader::workerLoop, this);
+    }
+    spdlog::debug("Preloader: 共 {} 项资源，{} 项需要解码，使用 {} 个线程。", total_, jobs_.size(), thread_count);
+}
+
+Preloader::~Preloader()
+{
+    cancel_ = true;
+    for (auto& worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    // 释放尚未交给缓存的结果
+    for (auto& decoded : decoded_) {
+        if (decoded.surface_) SDL_DestroySurface(decoded.surface_);
+        if (decoded.chunk_) Mix_FreeChunk(decoded.chunk_);
+    }
+}
+
+bool Preloader::update(float budget_ms)
+{
+    if (isDone()) return true;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Uint64 budget = static_cast<Uint64>(budget_ms / 1000.0 * SDL_GetPerformanceFrequency());
+    auto out_of_budget = [&] { return SDL_GetPerformanceCounter() - start > budget; };
+
+    // 1. 接收解码结果（纹理必须在主线程创建）
+    std::vector<Decoded> decoded;
+    {
+        std::lock_guard lock(decoded_mutex_);
+        decoded.swap(decoded_);
+    }
+    std::size_t i = 0;
+    for (; i < decoded.size() && !out_of_budget(); ++i) {
+        adopt(decoded[i]);
+    }
+    if (i < decoded.size()) {       // 超出预算，剩余的留到下一帧
+        std::lock_guard lock(decoded_mutex_);
+        decoded_.insert(decoded_.end(), std::make_move_iterator(decoded.begin() + i),
+                        std::make_move_iterator(decoded.end()));
+    }
+
+    // 2. 字体（SDL_ttf 不保证线程安全，在主线程打开）
+    while (next_font_ < manifest_.fonts_.size() && !out_of_budget()) {
+        const auto& [path, point_size] = manifest_.fonts_[next_font_++];
+        if (!resource_manager_.hasFont(path, point_size)) {
+            if (resource_manager_.loadFont(path, point_size)) loaded_.addFont(path, point_size);
+            else ++failed_;
+        }
+        ++completed_;
+    }
+
+    // 3. 音乐（由 AudioManager 的后台线程加载）
+    resource_manager_.pollAsyncLoads();
+    std::erase_if(music_waiting_, [this](const std::string& path) {
+        if (resource_manager_.isMusicPending(path)) return false;
+        ++completed_;
+        return true;
+    });
+
+    if (isDone()) {
+        spdlog::info("Preloader: 预加载完成，共 {} 项，失败 {} 项。", total_, failed_);
+    }
+    return isDone();
+}
+
+float Preloader::getProgress() const
+{
+    return total_ == 0 ? 1.0f : static_cast<float>(completed_) / static_cast<float>(total_);
+}
+
+void Preloader::releaseLoaded()
+{
+    std::size_t released = 0;
+    for (const auto& path : loaded_.textures_) {
+        if (resource_manager_.getRefCount(ResourceType::Texture, path) > 0 || !resource_manager_.hasTexture(path)) continue;
+        resource_manager_.unloadTexture(path);
+        ++released;
+    }
+    for (const auto& path : loaded_.sounds_) {
+        if (resource_manager_.getRefCount(ResourceType::Sound, path) > 0 || !resource_manager_.hasSound(path)) continue;
+        resource_manager_.unloadSound(path);
+        ++released;
+    }
+    for (const auto& path : loaded_.music_) {
+        if (resource_manager_.getRefCount(ResourceType::Music, path) > 0 || !resource_manager_.hasMusic(path)) continue;
+        resource_manager_.unloadMusic(path);
+        ++released;
+    }
+    for (const auto& [path, point_size] : loaded_.fonts_) {
+        if (resource_manager_.getRefCount(ResourceType::Font, path, point_size) > 0 ||
+            !resource_manager_.hasFont(path, point_size)) continue;
+        resource_manager_.unloadFont(path, point_size);
+        ++released;
+    }
+    spdlog::debug("Preloader: 已释放预加载的 {} 项资源。", released);
+    loaded_ = {};
+}
+
+void Preloader::workerLoop()
+{
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::RESOURCE);
+    while (!cancel_) {
+        std::size_t index = next_job_.fetch_add(1);
+        if (index >= jobs_.size()) return;
+        const auto& job = jobs_[index];
+
+        Decoded decoded{job.type_, job.path_};
+        if (job.type_ == Decoded::Type::Texture) {
+            if (SDL_IOStream* io = resource_manager_.openFile(job.path_)) decoded.surface_ = IMG_Load_IO(io, true);
+        } else {
+            decoded.chunk_ = resource_manager_.decodeSound(job.path_);     // 优先使用预处理的 PCM
+        }
+        if (!decoded.surface_ && !decoded.chunk_) {
+            spdlog::error("Preloader: 解码 '{}' 失败: {}", job.path_, SDL_GetError());
+        }
+
+        std::lock_guard lock(decoded_mutex_);
+        decoded_.push_back(std::move(decoded));
+    }
+}
+
+void Preloader::adopt(Decoded& decoded)
+{
+    bool ok = false;
+    if (decoded.surface_) {
+        ok = resource_manager_.addTexture(decoded.path_, decoded.surface_) != nullptr;
+        SDL_DestroySurface(decoded.surface_);
+        decoded.surface_ = nullptr;
+    } else if (decoded.chunk_) {
+        ok = resource_manager_.addSound(decoded.path_, decoded.chunk_) != nullptr;
+        decoded.chunk_ = nullptr;   // 所有权已转移
+    }
+    if (ok) {
+        if (decoded.type_ == Decoded::Type::Texture) loaded_.addTexture(decoded.path_);
+        else loaded_.addSound(decoded.path_);
+    }
+    if (!ok) ++failed_;
+    ++completed_;
+}
+
+} // namespace engine::resource
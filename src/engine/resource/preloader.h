@@ -0,0 +1,101 @@
+#pragma once
+#include "preload_manifest.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SDL_Surface;
+struct Mix_Chunk;
+
+namespace engine::resource {
+    class ResourceManager;
+
+/**
+ * @brief 按清单并行预加载资源。
+ *
+ * 图片与音效的解码（IMG_Load / Mix_LoadWAV）在工作线程中进行；
+ * 纹理创建、字体打开等必须在主线程完成的步骤在 update() 中按时间预算执行，
+ * 因此加载期间仍可以正常渲染加载界面。音乐交给 AudioManager 的后台线程。
+ * 析构时会等待工作线程结束，并释放尚未交给缓存的结果。
+ * 放弃预加载时可以调用 releaseLoaded()，卸载已经由本预加载器放入缓存的资源。
+ */
+class Preloader final {
+private:
+    /// @brief 工作线程的解码结果
+    struct Decoded {
+        enum class Type { Texture, Sound } type_;
+        std::string path_;
+        SDL_Surface* surface_ = nullptr;    ///< @brief 纹理：解码后的表面（失败为 nullptr）
+        Mix_Chunk* chunk_ = nullptr;        ///< @brief 音效：解码后的音效（失败为 nullptr）
+    };
+
+    /// @brief 工作线程要处理的任务
+    struct Job {
+        Decoded::Type type_;
+        std::string path_;
+    };
+
+    ResourceManager& resource_manager_;         ///< @brief 资源管理器引用
+    PreloadManifest manifest_;                  ///< @brief 加载清单（已去重）
+
+    std::vector<Job> jobs_;                     ///< @brief 工作线程任务列表（只读）
+    std::atomic<std::size_t> next_job_ = 0;     ///< @brief 下一个待领取的任务下标
+    std::atomic<bool> cancel_ = false;          ///< @brief 取消标志（析构时设置）
+    std::vector<std::thread> workers_;          ///< @brief 工作线程
+
+    std::mutex decoded_mutex_;                  ///< @brief 保护 decoded_
+    std::vector<Decoded> decoded_;              ///< @brief 已解码、等待主线程接收的结果
+
+    std::size_t next_font_ = 0;                 ///< @brief 下一个要在主线程打开的字体
+    std::vector<std::string> music_waiting_;    ///< @brief 仍在后台加载的音乐
+    PreloadManifest loaded_;                    ///< @brief 由本预加载器放入缓存的资源（之前未缓存，releaseLoaded 时卸载）
+    std::size_t completed_ = 0;                 ///< @brief 已完成的条目数（含失败）
+    std::size_t failed_ = 0;                    ///< @brief 失败的条目数
+    std::size_t total_ = 0;                     ///< @brief 条目总数
+
+public:
+    /**
+     * @brief 构造函数，已缓存的资源会直接计为完成。
+     * @param resource_manager 资源管理器。
+     * @param manifest 加载清单。
+     * @param thread_count 解码线程数（0 表示按硬件线程数自动选择）。
+     */
+    Preloader(ResourceManager& resource_manager, PreloadManifest manifest, unsigned int thread_count = 0);
+    ~Preloader();
+
+    // 禁止拷贝和移动
+    Preloader(const Preloader&) = delete;
+    Preloader& operator=(const Preloader&) = delete;
+    Preloader(Preloader&&) = delete;
+    Preloader& operator=(Preloader&&) = delete;
+
+    /**
+     * @brief 主线程每帧调用：把解码完成的资源放入缓存。
+     * @param budget_ms 本帧可用的时间预算（毫秒）。
+     * @return 全部完成时返回 true。
+     */
+    bool update(float budget_ms = 4.0f);
+
+    bool isDone() const { return completed_ >= total_; }   ///< @brief 是否全部完成
+    float getProgress() const;                              ///< @brief 进度 (0~1)
+    std::size_t getCompletedCount() const { return completed_; }    ///< @brief 已完成数量
+    std::size_t getFailedCount() const { return failed_; }          ///< @brief 失败数量
+    std::size_t getTotalCount() const { return total_; }            ///< @brief 总数量
+    const PreloadManifest& getManifest() const { return manifest_; }    ///< @brief 获取（去重后的）清单
+
+    /**
+     * @brief 卸载由本预加载器放入缓存、且没有被引用的资源（放弃预加载时调用，主线程）。
+     * 预加载之前已缓存的资源与已被句柄/资源作用域引用的资源保持不变。
+     * 调用时仍在后台加载的音乐无法撤回，加载完成后留在缓存中。
+     */
+    void releaseLoaded();
+
+private:
+    void workerLoop();                          ///< @brief 工作线程主循环
+    void adopt(Decoded& decoded);               ///< @brief 将解码结果放入缓存（主线程）
+};
+
+} // namespace engine::resource
@@ -0,0 +1,105 @@
+#pragma once
+#include "resource_manager.h"
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace engine::resource {
+
+/**
+ * @brief 带引用计数的资源句柄（无类型部分）。
+ *
+ * 构造时对资源调用 ResourceManager::retain()，析构时调用 release()；
+ * 最后一个句柄析构时资源被卸载。可拷贝（增加引用）与移动（转移引用）。
+ * 句柄只保存路径，每次 get() 都从缓存中查询，因此不会持有悬空指针。
+ */
+class ResourceHandle {
+protected:
+    ResourceManager* resource_manager_ = nullptr;   ///< @brief 资源管理器的非拥有指针（为空表示无效句柄）
+    ResourceType type_ = ResourceType::Texture;     ///< @brief 资源类型
+    std::string path_;                              ///< @brief 资源路径
+    int point_size_ = 0;                            ///< @brief 字号（仅字体使用）
+
+public:
+    ResourceHandle() = default;
+    ResourceHandle(ResourceManager& resource_manager, ResourceType type, std::string_view path, int point_size = 0)
+        : resource_manager_(&resource_manager), type_(type), path_(path), point_size_(point_size) {
+        resource_manager_->retain(type_, path_, point_size_);
+    }
+    ~ResourceHandle() { reset(); }
+
+    ResourceHandle(const ResourceHandle& other)
+        : resource_manager_(other.resource_manager_), type_(other.type_), path_(other.path_), point_size_(other.point_size_) {
+        if (resource_manager_) resource_manager_->retain(type_, path_, point_size_);
+    }
+    ResourceHandle& operator=(const ResourceHandle& other) {
+        if (this != &other) {
+            ResourceHandle copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    ResourceHandle(ResourceHandle&& other) noexcept
+        : resource_manager_(std::exchange(other.resource_manager_, nullptr)), type_(other.type_),
+          path_(std::move(other.path_)), point_size_(other.point_size_) {}
+    ResourceHandle& operator=(ResourceHandle&& other) noexcept {
+        if (this != &other) {
+            reset();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// @brief 释放引用，句柄变为无效
+    void reset() {
+        if (resource_manager_) {
+            resource_manager_->release(type_, path_, point_size_);
+            resource_manager_ = nullptr;
+        }
+    }
+
+    bool isValid() const { return resource_manager_ != nullptr; }     ///< @brief 句柄是否有效
+    ResourceType getType() const { return type_; }                    ///< @brief 获取资源类型
+    const std::string& getPath() const { return path_; }              ///< @brief 获取资源路径
+    int getPointSize() const { return point_size_; }                  ///< @brief 获取字号（仅字体）
+
+private:
+    void swap(ResourceHandle& other) noexcept {
+        std::swap(resource_manager_, other.resource_manager_);
+        std::swap(type_, other.type_);
+        std::swap(path_, other.path_);
+        std::swap(point_size_, other.point_size_);
+    }
+};
+
+/**
+ * @brief 带类型的资源句柄，get() 返回对应的 SDL 资源指针。
+ * @tparam Type 资源类型
+ */
+template <ResourceType Type>
+class TypedResourceHandle final : public ResourceHandle {
+public:
+    TypedResourceHandle() = default;
+    TypedResourceHandle(ResourceManager& resource_manager, std::string_view path, int point_size = 0)
+        : ResourceHandle(resource_manager, Type, path, point_size) {}
+
+    /// @brief 获取资源指针（音乐仍在后台加载时返回 nullptr）
+    auto get() const {
+        if constexpr (Type == ResourceType::Texture) {
+            return resource_manager_ ? resource_manager_->getTexture(path_) : nullptr;
+        } else if constexpr (Type == ResourceType::Sound) {
+            return resource_manager_ ? resource_manager_->getSound(path_) : nullptr;
+        } else if constexpr (Type == ResourceType::Music) {
+            return resource_manager_ ? resource_manager_->tryGetMusic(path_) : nullptr;
+        } else {
+            return resource_manager_ ? resource_manager_->getFont(path_, point_size_) : nullptr;
+        }
+    }
+};
+
+using TextureHandle = TypedResourceHandle<ResourceType::Texture>;
+using SoundHandle = TypedResourceHandle<ResourceType::Sound>;
+using MusicHandle = TypedResourceHandle<ResourceType::Music>;
+using FontHandle = TypedResourceHandle<ResourceType::Font>;
+
+} // namespace engine::resource
@@ -2,10 +2,12 @@
 #include "texture_manager.h"
 #include "audio_manager.h"
 #include "font_manager.h" 
+#include "asset_pack.h"
 #include <SDL3_mixer/SDL_mixer.h>
 #include <SDL3_ttf/SDL_ttf.h> 
 #include <glm/glm.hpp>
 #include <spdlog/spdlog.h>
+#include <nlohmann/json.hpp>
  
 namespace engine::resource {
 
@@ -13,9 +15,10 @@ ResourceManager::~ResourceManager() = default;
 
 ResourceManager::ResourceManager(SDL_Renderer* renderer) {
     // --- 初始化各个子系统 --- (如果出现错误会抛出异常，由上层捕获)
-    texture_manager_ = std::make_unique<TextureManager>(renderer);
-    audio_manager_ = std::make_unique<AudioManager>();
-    font_manager_ = std::make_unique<FontManager>();
+    asset_pack_ = std::make_unique<AssetPack>();
+    texture_manager_ = std::make_unique<TextureManager>(renderer, *asset_pack_);
+    audio_manager_ = std::make_unique<AudioManager>(*asset_pack_);
+    font_manager_ = std::make_unique<FontManager>(*asset_pack_);
 
     spdlog::trace("ResourceManager 构造成功。");
     // RAII: 构造成功即代表资源管理器可以正常工作，无需再初始化，无需检查指针是否为空
@@ -51,6 +54,26 @@ void ResourceManager::clearTextures() {
     texture_manager_->clearTextures();
 }
 
+SDL_Texture* ResourceManager::addTexture(std::string_view file_path, SDL_Surface* surface) {
+    return texture_manager_->addTexture(file_path, surface);
+}
+
+bool ResourceManager::hasTexture(std::string_view file_path) const {
+    return texture_manager_->hasTexture(file_path);
+}
+
+void ResourceManager::setTextureBudget(std::size_t budget_bytes) {
+    texture_manager_->setBudget(budget_bytes);
+}
+
+void ResourceManager::pinTexture(std::string_view file_path) {
+    texture_manager_->pinTexture(file_path);
+}
+
+void ResourceManager::unpinTexture(std::string_view file_path) {
+    texture_manager_->unpinTexture(file_path);
+}
+
 // --- 音频接口实现 ---
 Mix_Chunk* ResourceManager::loadSound(std::string_view file_path) {
     return audio_manager_->loadSound(file_path);
@@ -68,6 +91,30 @@ void ResourceManager::clearSounds() {
     audio_manager_->clearSounds();
 }
 
+Mix_Chunk* ResourceManager::addSound(std::string_view file_path, Mix_Chunk* chunk) {
+    return audio_manager_->addSound(file_path, chunk);
+}
+
+Mix_Chunk* ResourceManager::decodeSound(std::string_view file_path) const {
+    return audio_manager_->decodeSound(file_path);
+}
+
+bool ResourceManager::hasSound(std::string_view file_path) const {
+    return audio_manager_->hasSound(file_path);
+}
+
+void ResourceManager::setSoundBudget(std::size_t budget_bytes) {
+    audio_manager_->setSoundBudget(budget_bytes);
+}
+
+void ResourceManager::pinSound(std::string_view file_path) {
+    audio_manager_->pinSound(file_path);
+}
+
+void ResourceManager::unpinSound(std::string_view file_path) {
+    audio_manager_->unpinSound(file_path);
+}
+
 Mix_Music* ResourceManager::loadMusic(std::string_view file_path) {
     return audio_manager_->loadMusic(file_path);
 }
@@ -84,6 +131,77 @@ void ResourceManager::clearMusic() {
     audio_manager_->clearMusic();
 }
 
+void ResourceManager::prefetchMusic(std::string_view id_or_path) {
+    audio_manager_->requestMusic(resolvePath(id_or_path));
+}
+
+Mix_Music* ResourceManager::tryGetMusic(std::string_view file_path) {
+    return audio_manager_->tryGetMusic(file_path);
+}
+
+bool ResourceManager::hasMusic(std::string_view file_path) const {
+    return audio_manager_->hasMusic(file_path);
+}
+
+bool ResourceManager::isMusicPending(std::string_view file_path) const {
+    return audio_manager_->isMusicPending(file_path);
+}
+
+void ResourceManager::pollAsyncLoads() {
+    audio_manager_->pollMusicLoads();
+}
+
+// --- 资源包 ---
+bool ResourceManager::mountPack(std::string_view pack_path) {
+    return asset_pack_->mount(pack_path);
+}
+
+SDL_IOStream* ResourceManager::openFile(std::string_view file_path) const {
+    return asset_pack_->open(file_path);
+}
+
+std::optional<std::string> ResourceManager::readTextFile(std::string_view file_path) const {
+    return asset_pack_->readText(file_path);
+}
+
+std::optional<std::string> ResourceManager::readLooseTextFile(std::string_view file_path) const {
+    return AssetPack::readLooseText(file_path);     // 资源包中的是打包时的旧内容
+}
+
+// --- 热重载 ---
+void ResourceManager::reloadFile(std::string_view file_path) {
+    texture_manager_->reloadTexture(file_path);
+    file_reload_signal_.publish(file_path);
+}
+
+// --- 资源ID映射 ---
+bool ResourceManager::loadResourceMapping(std::string_view mapping_path) {
+    auto text = asset_pack_->readText(mapping_path);
+    if (!text) {
+        spdlog::warn("无法打开资源映射文件: {}", mapping_path);
+        return false;
+    }
+    try {
+        nlohmann::json j = nlohmann::json::parse(*text);
+        for (const char* section : {"sound", "music"}) {
+            if (!j.contains(section) || !j[section].is_object()) continue;
+            for (const auto& [id, path] : j[section].items()) {
+                if (path.is_string()) path_mapping_[id] = path.get<std::string>();
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("解析资源映射文件 '{}' 失败: {}", mapping_path, e.what());
+        return false;
+    }
+    spdlog::debug("已读取资源映射文件 '{}'，共 {} 项。", mapping_path, path_mapping_.size());
+    return true;
+}
+
+std::string_view ResourceManager::resolvePath(std::string_view id_or_path) const {
+    auto it = path_mapping_.find(id_or_path);
+    return it != path_mapping_.end() ? std::string_view(it->second) : id_or_path;
+}
+
 // --- 字体接口实现 ---
 TTF_Font* ResourceManager::loadFont(std::string_view file_path, int point_size) {
     return font_manager_->loadFont(file_path, point_size);
@@ -94,6 +212,10 @@ TTF_Font* ResourceManager::getFont(std::string_view file_path, int point_size) {
 }
 
 void ResourceManager::unloadFont(std::string_view file_path, int point_size) {
+    // 先通知文字渲染器丢弃依赖该字体的缓存
+    if (font_manager_->hasFont(file_path, point_size)) {
+        font_release_signal_.publish(font_manager_->getFont(file_path, point_size));
+    }
     font_manager_->unloadFont(file_path, point_size);
 }
 
@@ -101,4 +223,92 @@ void ResourceManager::clearFonts() {
     font_manager_->clearFonts();
 }
 
+bool ResourceManager::hasFont(std::string_view file_path, int point_size) const {
+    return font_manager_->hasFont(file_path, point_size);
+}
+
+// --- 引用计数 ---
+namespace {
+std::string makeRefKey(ResourceType type, std::string_view file_path, int point_size) {
+    std::string key;
+    key.reserve(file_path.size() + 8);
+    key += static_cast<char>('0' + static_cast<int>(type));
+    key += '|';
+    key += file_path;
+    if (type == ResourceType::Font) {
+        key += '|';
+        key += std::to_string(point_size);
+    }
+    return key;
+}
+} // namespace
+
+void ResourceManager::retain(ResourceType type, std::string_view file_path, int point_size) {
+    if (++ref_counts_[makeRefKey(type, file_path, point_size)] > 1) return;
+
+    // 第一次引用：确保资源已加载，并固定以免被 LRU 淘汰
+    switch (type) {
+        case ResourceType::Texture:
+            if (texture_manager_->loadTexture(file_path)) texture_manager_->pinTexture(file_path);
+            break;
+        case ResourceType::Sound:
+            if (audio_manager_->loadSound(file_path)) audio_manager_->pinSound(file_path);
+            break;
+        case ResourceType::Music:
+            audio_manager_->requestMusic(file_path);    // 后台加载，不阻塞
+            break;
+        case ResourceType::Font:
+            font_manager_->loadFont(file_path, point_size);
+            break;
+    }
+}
+
+void ResourceManager::release(ResourceType type, std::string_view file_path, int point_size) {
+    auto it = ref_counts_.find(makeRefKey(type, file_path, point_size));
+    if (it == ref_counts_.end()) {
+        spdlog::warn("尝试释放未被引用的资源: {}", file_path);
+        return;
+    }
+    if (--it->second > 0) return;
+    ref_counts_.erase(it);
+
+    // 引用归零：卸载资源（未加载成功的资源不会出现在缓存中，只需跳过）
+    switch (type) {
+        case ResourceType::Texture:
+            if (texture_manager_->hasTexture(file_path)) texture_manager_->unloadTexture(file_path);
+            break;
+        case ResourceType::Sound:
+            if (audio_manager_->hasSound(file_path)) audio_manager_->unloadSound(file_path);
+            break;
+        case ResourceType::Music:
+            if (audio_manager_->hasMusic(file_path)) audio_manager_->unloadMusic(file_path);
+            break;
+        case ResourceType::Font:
+            if (font_manager_->hasFont(file_path, point_size)) unloadFont(file_path, point_size);
+            break;
+    }
+}
+
+int ResourceManager::getRefCount(ResourceType type, std::string_view file_path, int point_size) const {
+    auto it = ref_counts_.find(makeRefKey(type, file_path, point_size));
+    return it != ref_counts_.end() ? it->second : 0;
+}
+
+// --- 缓存统计 ---
+CacheStats ResourceManager::getTextureStats() const {
+    return texture_manager_->getStats();
+}
+
+CacheStats ResourceManager::getSoundStats() const {
+    return audio_manager_->getSoundStats();
+}
+
+CacheStats ResourceManager::getMusicStats() const {
+    return audio_manager_->getMusicStats();
+}
+
+CacheStats ResourceManager::getFontStats() const {
+    return font_manager_->getStats();
+}
+
 } // namespace engine::resource
@@ -2,21 +2,34 @@
 #include <memory> // 用于 std::unique_ptr
 #include <string> // 用于 std::string
 #include <string_view> // 用于 std::string_view
+#include <cstddef>
+#include <unordered_map>
+#include <cstdint>
+#include <optional>
+#include <entt/signal/sigh.hpp>
 #include <glm/glm.hpp>
+#include "cache_stats.h"
+#include "../utils/string_hash.h"
 
 // 前向声明 SDL 类型
 struct SDL_Renderer;
 struct SDL_Texture;
+struct SDL_Surface;
+struct SDL_IOStream;
 struct Mix_Chunk;
 struct Mix_Music;
 struct TTF_Font;
 
 namespace engine::resource {
 
+/// @brief 资源类型（用于引用计数与资源句柄）
+enum class ResourceType : std::uint8_t { Texture, Sound, Music, Font };
+
 // 前向声明内部管理器
 class TextureManager;
 class AudioManager;
 class FontManager;
+class AssetPack;
 
 /**
  * @brief 作为访问各种资源管理器的中央控制点（外观模式 Facade）。
@@ -25,10 +38,17 @@ class FontManager;
 class ResourceManager final{
 private:
     // 使用 unique_ptr 确保所有权和自动清理
+    std::unique_ptr<AssetPack> asset_pack_;             ///< @brief 资源包，子管理器持有其引用，需最先创建、最后销毁
     std::unique_ptr<TextureManager> texture_manager_;
     std::unique_ptr<AudioManager> audio_manager_;
     std::unique_ptr<FontManager> font_manager_;
 
+    std::unordered_map<std::string, std::string, engine::utils::StringHash, std::equal_to<>> path_mapping_; ///< @brief 资源ID -> 文件路径（来自 resource_mapping.json）
+
+    std::unordered_map<std::string, int> ref_counts_;           ///< @brief 引用计数（键由类型、路径和字号组成）
+    entt::sigh<void(TTF_Font*)> font_release_signal_;           ///< @brief 字体即将因引用归零而卸载时发出
+    entt::sigh<void(std::string_view)> file_reload_signal_;     ///< @brief 磁盘上的资源文件被修改时发出（热重载）
+
 public:
     /**
      * @brief 构造函数，执行初始化。
@@ -46,6 +66,18 @@ public:
     ResourceManager(ResourceManager&&) = delete;
     ResourceManager& operator=(ResourceManager&&) = delete;
 
+    // --- 资源包 ---
+    /**
+     * @brief 挂载资源包（如 assets.pak）。之后包内的文件从映射内存读取，包中没有的文件仍从磁盘读取。
+     * 应在开始加载任何资源之前调用。
+     * @return 挂载成功返回 true；包不存在时返回 false，所有文件照常从磁盘读取。
+     */
+    bool mountPack(std::string_view pack_path);
+    const AssetPack& getAssetPack() const { return *asset_pack_; }  ///< @brief 获取资源包（挂载后只读，可在工作线程中读取）
+    SDL_IOStream* openFile(std::string_view file_path) const;      ///< @brief 打开文件（优先资源包），调用者负责关闭
+    std::optional<std::string> readTextFile(std::string_view file_path) const;    ///< @brief 读取文本文件（优先资源包）
+    std::optional<std::string> readLooseTextFile(std::string_view file_path) const;   ///< @brief 直接读取磁盘上的散文件（热重载用）
+
     // --- 统一资源访问接口 ---
     // -- Texture --
     SDL_Texture* loadTexture(std::string_view file_path);     ///< @brief 载入纹理资源
@@ -53,24 +85,83 @@ public:
     void unloadTexture(std::string_view file_path);          ///< @brief 卸载指定的纹理资源
     glm::vec2 getTextureSize(std::string_view file_path);    ///< @brief 获取指定纹理的尺寸
     void clearTextures();                                      ///< @brief 清空所有纹理资源
+    SDL_Texture* addTexture(std::string_view file_path, SDL_Surface* surface); ///< @brief 由预先解码的表面创建并缓存纹理（不获取表面所有权）
+    bool hasTexture(std::string_view file_path) const;         ///< @brief 纹理是否已缓存
+    void setTextureBudget(std::size_t budget_bytes);           ///< @brief 设置纹理内存预算（字节，0 表示不限制），超出时按 LRU 淘汰
+    void pinTexture(std::string_view file_path);               ///< @brief 固定纹理，使其不会被淘汰
+    void unpinTexture(std::string_view file_path);             ///< @brief 取消一次固定
 
     // -- Sound Effects (Chunks) --
     Mix_Chunk* loadSound(std::string_view file_path);         ///< @brief 载入音效资源
     Mix_Chunk* getSound(std::string_view file_path);          ///< @brief 尝试获取已加载音效的指针，如果未加载则尝试加载
     void unloadSound(std::string_view file_path);             ///< @brief 卸载指定的音效资源
     void clearSounds();                                         ///< @brief 清空所有音效资源
+    Mix_Chunk* addSound(std::string_view file_path, Mix_Chunk* chunk);   ///< @brief 缓存预先解码的音效（获取所有权）
+    Mix_Chunk* decodeSound(std::string_view file_path) const;   ///< @brief 解码音效但不缓存（可在工作线程调用，调用者获得所有权）
+    bool hasSound(std::string_view file_path) const;            ///< @brief 音效是否已缓存
+    void setSoundBudget(std::size_t budget_bytes);              ///< @brief 设置音效内存预算（字节，0 表示不限制），超出时按 LRU 淘汰
+    void pinSound(std::string_view file_path);                  ///< @brief 固定音效，使其不会被淘汰
+    void unpinSound(std::string_view file_path);                ///< @brief 取消一次固定
 
     // -- Music --
     Mix_Music* loadMusic(std::string_view file_path);         ///< @brief 载入音乐资源
     Mix_Music* getMusic(std::string_view file_path);          ///< @brief 尝试获取已加载音乐的指针，如果未加载则尝试加载
     void unloadMusic(std::string_view file_path);             ///< @brief 卸载指定的音乐资源
     void clearMusic();                                          ///< @brief 清空所有音乐资源
+    void prefetchMusic(std::string_view id_or_path);          ///< @brief 预取提示：在后台线程加载音乐，不阻塞当前帧
+    Mix_Music* tryGetMusic(std::string_view file_path);       ///< @brief 非阻塞获取音乐，未就绪时开始后台加载并返回 nullptr
+    bool isMusicPending(std::string_view file_path) const;    ///< @brief 音乐是否仍在后台加载中
+    bool hasMusic(std::string_view file_path) const;          ///< @brief 音乐是否已缓存
+    void pollAsyncLoads();                                      ///< @brief 接收后台加载完成的资源（每帧调用一次）
+
+    // -- 资源ID映射 --
+    /**
+     * @brief 从映射文件（如 assets/data/resource_mapping.json）读取 "sound" 与 "music" 的 ID -> 路径映射。
+     * @return 读取成功返回 true。
+     */
+    bool loadResourceMapping(std::string_view mapping_path);
+    /**
+     * @brief 将资源ID解析为路径，未映射时原样返回（不分配内存）。
+     * @return 指向映射表或 id_or_path 本身的视图：未映射时与参数的生命周期相同，映射表重新加载后失效。
+     */
+    std::string_view resolvePath(std::string_view id_or_path) const;
 
     // -- Fonts --
     TTF_Font* loadFont(std::string_view file_path, int point_size);     ///< @brief 载入字体资源
     TTF_Font* getFont(std::string_view file_path, int point_size);      ///< @brief 尝试获取已加载字体的指针，如果未加载则尝试加载
-    void unloadFont(std::string_view file_path, int point_size);        ///< @brief 卸载指定的字体资源
+    void unloadFont(std::string_view file_path, int point_size);        ///< @brief 卸载指定的字体资源（先发出 onFontRelease() 信号）
     void clearFonts();                                                  ///< @brief 清空所有字体资源
+    bool hasFont(std::string_view file_path, int point_size) const;     ///< @brief 字体是否已缓存
+
+    // -- 引用计数 (由 ResourceHandle 使用) --
+    /**
+     * @brief 增加引用计数。第一次引用时加载资源（音乐为后台加载），并使其不会被 LRU 淘汰。
+     * @param point_size 字号（仅字体使用）。
+     */
+    void retain(ResourceType type, std::string_view file_path, int point_size = 0);
+    /**
+     * @brief 减少引用计数。归零时立即卸载该资源。
+     * 字体卸载前会先发出 onFontRelease() 信号，以便文字渲染器丢弃依赖它的缓存。
+     */
+    void release(ResourceType type, std::string_view file_path, int point_size = 0);
+    int getRefCount(ResourceType type, std::string_view file_path, int point_size = 0) const;  ///< @brief 获取引用计数
+    std::size_t getReferencedCount() const { return ref_counts_.size(); }                       ///< @brief 获取被引用的资源数量
+    auto onFontRelease() { return entt::sink{font_release_signal_}; }                           ///< @brief 字体卸载信号
+
+    // -- 热重载 (调试用) --
+    /**
+     * @brief 磁盘上的文件被修改时调用（由 GameApp 的文件监视器驱动）。
+     * 已缓存的对应纹理被原子替换，之后发出 onFileReload() 信号，
+     * 由场景自行重新读取地图图层、数据 JSON 等，无需重建场景。
+     */
+    void reloadFile(std::string_view file_path);
+    auto onFileReload() { return entt::sink{file_reload_signal_}; }                            ///< @brief 文件热重载信号
+
+    // -- 缓存统计 (调试用) --
+    CacheStats getTextureStats() const;                                 ///< @brief 获取纹理缓存统计
+    CacheStats getSoundStats() const;                                   ///< @brief 获取音效缓存统计
+    CacheStats getMusicStats() const;                                   ///< @brief 获取音乐缓存统计
+    CacheStats getFontStats() const;                                    ///< @brief 获取字体缓存统计
 };
 
 } // namespace engine::resource
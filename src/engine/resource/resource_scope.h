@@ -0,0 +1,55 @@
+#pragma once
+#include "resource_handle.h"
+#include "preload_manifest.h"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace engine::resource {
+
+/**
+ * @brief 资源作用域：持有一组资源句柄，作用域结束（或 releaseAll()）时一并释放。
+ *
+ * 每个场景拥有一个作用域。场景通过它引用的资源在场景销毁时释放；
+ * 同一资源被多个场景引用时，只有最后一个场景销毁后才会卸载。
+ */
+class ResourceScope final {
+private:
+    ResourceManager& resource_manager_;         ///< @brief 资源管理器引用
+    std::vector<ResourceHandle> handles_;       ///< @brief 作用域持有的句柄
+
+public:
+    explicit ResourceScope(ResourceManager& resource_manager) : resource_manager_(resource_manager) {}
+
+    // 禁止拷贝和移动
+    ResourceScope(const ResourceScope&) = delete;
+    ResourceScope& operator=(const ResourceScope&) = delete;
+    ResourceScope(ResourceScope&&) = delete;
+    ResourceScope& operator=(ResourceScope&&) = delete;
+
+    TextureHandle texture(std::string_view path) { return track(TextureHandle(resource_manager_, path)); }    ///< @brief 引用纹理
+    SoundHandle sound(std::string_view path) { return track(SoundHandle(resource_manager_, path)); }          ///< @brief 引用音效
+    MusicHandle music(std::string_view path) { return track(MusicHandle(resource_manager_, path)); }          ///< @brief 引用音乐（后台加载）
+    FontHandle font(std::string_view path, int point_size) { return track(FontHandle(resource_manager_, path, point_size)); }  ///< @brief 引用字体
+
+    /// @brief 引用清单中的全部资源（通常在预加载完成后交给目标场景）
+    void retain(const PreloadManifest& manifest) {
+        handles_.reserve(handles_.size() + manifest.size());
+        for (const auto& path : manifest.textures_) handles_.emplace_back(resource_manager_, ResourceType::Texture, path);
+        for (const auto& path : manifest.sounds_) handles_.emplace_back(resource_manager_, ResourceType::Sound, path);
+        for (const auto& path : manifest.music_) handles_.emplace_back(resource_manager_, ResourceType::Music, path);
+        for (const auto& [path, point_size] : manifest.fonts_) handles_.emplace_back(resource_manager_, ResourceType::Font, path, point_size);
+    }
+
+    void releaseAll() { handles_.clear(); }                         ///< @brief 释放作用域持有的全部引用
+    std::size_t size() const { return handles_.size(); }            ///< @brief 持有的句柄数量
+
+private:
+    template <typename Handle>
+    Handle track(Handle handle) {
+        handles_.push_back(handle);     // 以基类形式保存一份拷贝（增加一次引用）
+        return handle;
+    }
+};
+
+} // namespace engine::resource
@@ -1,10 +1,23 @@
 #include "texture_manager.h"
 #include <SDL3_image/SDL_image.h> // 用于 IMG_LoadTexture, IMG_Init, IMG_Quit
 #include <spdlog/spdlog.h>
+#include "../debug/log.h"
+#include "../debug/alloc_counter.h"
+#include <filesystem>
 #include <stdexcept>
 
 namespace engine::resource {
-TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
+
+namespace {
+/// @brief 估算显存占用：宽 x 高 x 每像素字节数
+std::size_t textureBytes(const SDL_Texture* texture) {
+    return static_cast<std::size_t>(texture->w) * static_cast<std::size_t>(texture->h) *
+           static_cast<std::size_t>(SDL_BYTESPERPIXEL(texture->format));
+}
+} // namespace
+
+TextureManager::TextureManager(SDL_Renderer* renderer, const AssetPack& asset_pack)
+    : renderer_(renderer), asset_pack_(asset_pack) {
     if (!renderer_) {
         // 关键错误，无法继续，抛出异常 （它将由catch语句捕获（位于GameApp），并进行处理）
         throw std::runtime_error("TextureManager 构造失败: 渲染器指针为空。");
@@ -14,41 +27,42 @@ TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
 }
 
 SDL_Texture* TextureManager::loadTexture(std::string_view file_path) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::RESOURCE);
     // 检查是否已加载
-    auto it = textures_.find(std::string(file_path));   // 键为std::string, 因此需要转换
+    auto it = textures_.find(file_path);    // 透明哈希，直接用 string_view 查找
     if (it != textures_.end()) {
-        return it->second.get();
+        return it->second.texture_.get();
     }
 
     // 如果没加载则尝试加载纹理
-    SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.data());    // 通过.data()获取const char*的指针
-
-    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
-    }
+    SDL_IOStream* io = asset_pack_.open(file_path);        // 资源包中的内存视图，或磁盘文件
+    SDL_Texture* raw_texture = io ? IMG_LoadTexture_IO(renderer_, io, true) : nullptr;    // true: 读取后关闭 io
 
     if (!raw_texture) {
         spdlog::error("加载纹理失败: '{}': {}", file_path, SDL_GetError());
         return nullptr;
     }
+    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+    }
 
-    // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
-    textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
     spdlog::debug("成功加载并缓存纹理: {}", file_path);
-
-    return raw_texture;
+    return insertTexture(file_path, raw_texture);
 }
 
 SDL_Texture* TextureManager::getTexture(std::string_view file_path) {
     // 查找现有纹理
-    auto it = textures_.find(std::string(file_path));
+    auto it = textures_.find(file_path);
     if (it != textures_.end()) {
-        return it->second.get();
+        ++stats_.hits_;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it_);    // 移到表头（最近使用）
+        return it->second.texture_.get();
     }
 
     // 如果未找到，尝试加载它
-    spdlog::warn("纹理 '{}' 未找到缓存，尝试加载。", file_path);
+    ++stats_.misses_;
+    ENGINE_LOG_THROTTLED(spdlog::level::warn, 1000, "纹理 '{}' 未找到缓存，尝试加载。", file_path);
     return loadTexture(file_path);
 }
 
@@ -70,9 +84,11 @@ glm::vec2 TextureManager::getTextureSize(std::string_view file_path) {
 }
 
 void TextureManager::unloadTexture(std::string_view file_path) {
-    auto it = textures_.find(std::string(file_path));
+    auto it = textures_.find(file_path);
     if (it != textures_.end()) {
         spdlog::debug("卸载纹理: {}", file_path);
+        stats_.bytes_ -= it->second.bytes_;
+        lru_.erase(it->second.lru_it_);
         textures_.erase(it); // unique_ptr 通过自定义删除器处理删除
     } else {
         spdlog::warn("尝试卸载不存在的纹理: {}", file_path);
@@ -83,7 +99,125 @@ void TextureManager::clearTextures() {
     if (!textures_.empty()) {
         spdlog::debug("正在清除所有 {} 个缓存的纹理。", textures_.size());
         textures_.clear(); // unique_ptr 处理所有元素的删除
+        lru_.clear();
+        stats_.bytes_ = 0;
+    }
+}
+
+SDL_Texture* TextureManager::addTexture(std::string_view file_path, SDL_Surface* surface) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::RESOURCE);
+    auto it = textures_.find(file_path);
+    if (it != textures_.end()) {
+        return it->second.texture_.get();
+    }
+
+    SDL_Texture* raw_texture = SDL_CreateTextureFromSurface(renderer_, surface);
+    if (!raw_texture) {
+        spdlog::error("由表面创建纹理失败: '{}': {}", file_path, SDL_GetError());
+        return nullptr;
+    }
+    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+    }
+
+    spdlog::debug("成功缓存预加载的纹理: {}", file_path);
+    return insertTexture(file_path, raw_texture);
+}
+
+bool TextureManager::hasTexture(std::string_view file_path) const {
+    return textures_.contains(file_path);
+}
+
+CacheStats TextureManager::getStats() const {
+    CacheStats stats = stats_;
+    stats.entries_ = textures_.size();
+    return stats;
+}
+
+void TextureManager::setBudget(std::size_t budget_bytes) {
+    stats_.budget_bytes_ = budget_bytes;
+    evictToBudget();
+}
+
+void TextureManager::pinTexture(std::string_view file_path) {
+    auto it = textures_.find(file_path);
+    if (it != textures_.end()) {
+        ++it->second.pin_count_;
+    } else {
+        spdlog::warn("尝试固定不存在的纹理: {}", file_path);
+    }
+}
+
+void TextureManager::unpinTexture(std::string_view file_path) {
+    auto it = textures_.find(file_path);
+    if (it != textures_.end() && it->second.pin_count_ > 0) {
+        --it->second.pin_count_;
+    }
+}
+
+SDL_Texture* TextureManager::insertTexture(std::string_view file_path, SDL_Texture* texture) {
+    std::size_t bytes = textureBytes(texture);
+
+    lru_.emplace_front(file_path);
+    TextureEntry entry;
+    entry.texture_.reset(texture);
+    entry.bytes_ = bytes;
+    entry.lru_it_ = lru_.begin();
+    textures_.emplace(file_path, std::move(entry));
+    stats_.bytes_ += bytes;
+
+    evictToBudget();
+    return texture;
+}
+
+void TextureManager::evictToBudget() {
+    if (stats_.budget_bytes_ == 0) return;
+
+    // 从最久未使用的一端开始淘汰；刚加入的纹理位于表头，不会被淘汰
+    auto it = lru_.end();
+    while (stats_.bytes_ > stats_.budget_bytes_ && it != lru_.begin()) {
+        --it;
+        if (it == lru_.begin()) break;
+        auto entry_it = textures_.find(*it);
+        if (entry_it->second.pin_count_ > 0) continue;
+
+        spdlog::debug("纹理缓存超出预算，淘汰: {}", *it);
+        stats_.bytes_ -= entry_it->second.bytes_;
+        ++stats_.evictions_;
+        textures_.erase(entry_it);
+        it = lru_.erase(it);
+    }
+}
+
+int TextureManager::reloadTexture(std::string_view file_path) {
+    std::error_code ec;
+    const auto target = std::filesystem::weakly_canonical(std::filesystem::path(file_path), ec);
+    if (ec) return 0;
+
+    int reloaded = 0;
+    for (auto& [path, entry] : textures_) {
+        auto cached = std::filesystem::weakly_canonical(std::filesystem::path(path), ec);
+        if (ec || cached != target) continue;
+
+        // 直接读取磁盘上的散文件（资源包中的是打包时的旧内容）
+        SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, path.c_str());
+        if (!raw_texture) {
+            spdlog::error("热重载纹理失败，保留旧纹理: '{}': {}", path, SDL_GetError());
+            continue;
+        }
+        if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+        }
+
+        std::size_t bytes = textureBytes(raw_texture);
+        stats_.bytes_ = stats_.bytes_ - entry.bytes_ + bytes;
+        entry.bytes_ = bytes;
+        entry.texture_.reset(raw_texture);      // 新纹理就绪后才替换，旧纹理在此销毁
+        ++reloaded;
+        spdlog::info("已热重载纹理: {}", path);
     }
+    if (reloaded > 0) evictToBudget();
+    return reloaded;
 }
 
 } // namespace engine::resource
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <list>
 #include <memory>       // 用于 std::unique_ptr
 #include <stdexcept>    // 用于 std::runtime_error
 #include <string>       // 用于 std::string
@@ -6,6 +8,9 @@
 #include <unordered_map> // 用于 std::unordered_map
 #include <SDL3/SDL_render.h> // 用于 SDL_Texture 和 SDL_Renderer
 #include <glm/glm.hpp>
+#include "cache_stats.h"
+#include "asset_pack.h"
+#include "../utils/string_hash.h"
 
 namespace engine::resource {
 
@@ -28,18 +33,30 @@ private:
         }
     };
 
-    // 存储文件路径和指向管理纹理的 unique_ptr 的映射。(容器的键不可使用std::string_view)
-    std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+    /// @brief 缓存条目：纹理及其内存占用、固定计数和在 LRU 链表中的位置
+    struct TextureEntry {
+        std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture_;
+        std::size_t bytes_ = 0;                         ///< @brief 估算的显存占用（宽 x 高 x 每像素字节数）
+        int pin_count_ = 0;                             ///< @brief 固定计数，大于 0 时不会被淘汰
+        std::list<std::string>::iterator lru_it_;       ///< @brief 在 lru_ 中的位置
+    };
+
+    // 存储文件路径和纹理条目的映射。(容器的键不可使用std::string_view；透明哈希使查找时无需构造std::string)
+    std::unordered_map<std::string, TextureEntry, engine::utils::StringHash, std::equal_to<>> textures_;
+    std::list<std::string> lru_;       // 最近使用顺序，表头为最近使用
 
     SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
+    const AssetPack& asset_pack_;      // 资源包（文件读取入口）
+    CacheStats stats_;                 // 缓存命中统计（含内存占用与淘汰次数）
 
 public:
     /**
      * @brief 构造函数，执行初始化。
      * @param renderer 指向有效的 SDL_Renderer 上下文的指针。不能为空。
+     * @param asset_pack 资源包，所有文件经由它读取。
      * @throws std::runtime_error 如果 renderer 为 nullptr 或初始化失败。
      */
-    explicit TextureManager(SDL_Renderer* renderer);
+    TextureManager(SDL_Renderer* renderer, const AssetPack& asset_pack);
 
     // 当前设计中，我们只需要一个TextureManager，所有权不变，所以不需要拷贝、移动相关构造及赋值运算符
     TextureManager(const TextureManager&) = delete;
@@ -54,6 +71,28 @@ private: // 仅供 ResourceManager 访问的方法
     glm::vec2 getTextureSize(std::string_view file_path);      ///< @brief 获取指定纹理的尺寸
     void unloadTexture(std::string_view file_path);            ///< @brief 卸载指定的纹理资源
     void clearTextures();                                        ///< @brief 清空所有纹理资源
+    SDL_Texture* addTexture(std::string_view file_path, SDL_Surface* surface);   ///< @brief 由已解码的表面创建并缓存纹理（不获取表面所有权）
+    bool hasTexture(std::string_view file_path) const;           ///< @brief 纹理是否已缓存（不计入命中统计）
+    CacheStats getStats() const;                                 ///< @brief 获取纹理缓存统计
+
+    /**
+     * @brief 设置内存预算，超出时按 LRU 顺序淘汰未被固定的纹理。
+     * @param budget_bytes 预算（字节），0 表示不限制。
+     */
+    void setBudget(std::size_t budget_bytes);
+    void pinTexture(std::string_view file_path);                 ///< @brief 固定纹理（不会被淘汰），可重复调用
+    void unpinTexture(std::string_view file_path);               ///< @brief 取消一次固定
+
+    /**
+     * @brief 热重载：从磁盘重新读取与 file_path 指向同一文件的已缓存纹理，原子地替换缓存条目。
+     * 新纹理创建成功后才销毁旧纹理，失败时保留旧纹理；固定计数与 LRU 位置保持不变。
+     * 缓存键可能是相对路径或 LevelLoader 解析出的绝对路径，按规范化后的路径比较。
+     * @return 被替换的条目数量。
+     */
+    int reloadTexture(std::string_view file_path);
+
+    SDL_Texture* insertTexture(std::string_view file_path, SDL_Texture* texture);   ///< @brief 记录新纹理并按预算淘汰
+    void evictToBudget();                                        ///< @brief 从 LRU 尾部淘汰，直到不超出预算
 };
 
 } // namespace engine::resource
@@ -3,8 +3,6 @@
 #include "../component/transform_component.h"
 #include "../component/tilelayer_component.h"
 #include "../component/sprite_component.h"
-#include "../component/collider_component.h"
-#include "../component/physics_component.h"
 #include "../component/animation_component.h"
 #include "../component/health_component.h"
 #include "../component/audio_component.h"
@@ -12,30 +10,285 @@
 #include "../scene/scene.h"
 #include "../core/context.h"
 #include "../resource/resource_manager.h"
+#include "../resource/asset_pack.h"
 #include "../render/sprite.h"
 #include "../render/animation.h"
+#include "../debug/alloc_counter.h"
 #include "../utils/math.h"
+#include "../utils/parallel_for.h"
 #include <nlohmann/json.hpp>
-#include <fstream>
+#include <algorithm>
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
+#include <SDL3/SDL_timer.h>
 #include <filesystem>
 
 namespace engine::scene {
 
+namespace {
+/// @brief 获取 json 中数组字段的长度（不存在或不是数组时为0），避免 value() 拷贝整个数组
+std::size_t arraySize(const nlohmann::json& json, const char* key) {
+    auto it = json.find(key);
+    return (it != json.end() && it->is_array()) ? it->size() : 0;
+}
+
+/// @brief 读取文本文件：优先资源包；pack 为 nullptr 时直接读取磁盘散文件（热重载）
+std::optional<std::string> readText(const engine::resource::AssetPack* pack, std::string_view path) {
+    return pack ? pack->readText(path) : engine::resource::AssetPack::readLooseText(path);
+}
+} // namespace
+
+LevelLoader::LevelLoader() = default;
+LevelLoader::~LevelLoader() = default;
+
 bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
-    // 1. 加载 JSON 文件
-    auto path = std::filesystem::path(level_path);
-    std::ifstream file(path);
-    if (!file.is_open()) {
+    if (!beginLevel(level_path, scene)) return false;
+    update(0.0f);       // 不限时间，一次完成
+    return !hasFailed();
+}
+
+bool LevelLoader::beginLevel(std::string_view level_path, Scene& scene) {
+    if (level_path.empty()) {
+        spdlog::error("关卡地图路径为空。");
+        stage_ = LoadStage::Failed;
+        return false;
+    }
+    scene_ = &scene;
+    asset_pack_ = &scene.getContext().getResourceManager().getAssetPack();
+    map_path_ = level_path;
+    map_json_ = nlohmann::json();
+    pending_tilesets_.clear();
+    decoded_layers_.clear();
+    decode_jobs_.clear();
+    next_layer_ = 0;
+    next_item_ = 0;
+    total_work_ = 0;
+    done_work_ = 0;
+    stage_ = LoadStage::Parse;      // 地图文件在第一次 update() 中读取
+    return true;
+}
+
+void LevelLoader::parseLevel() {
+    nlohmann::json json_data;
+    if (!parseMap(std::string(map_path_), json_data)) {
+        failLevel();
+        return;
+    }
+
+    // 5. 检查图层数据，并统计总工作量（用于进度显示）
+    if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
+        spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", map_path_);
+        failLevel();
+        return;
+    }
+    total_work_ = pending_tilesets_.size();
+    for (const auto& layer_json : json_data["layers"]) {
+        if (!layer_json.value("visible", true)) continue;
+        std::string layer_type = layer_json.value("type", "none");
+        if (layer_type == "imagelayer") {
+            total_work_ += 1;
+        } else if (layer_type == "tilelayer") {
+            total_work_ += arraySize(layer_json, "data");
+        } else if (layer_type == "objectgroup") {
+            total_work_ += arraySize(layer_json, "objects");
+        }
+    }
+
+    map_json_ = std::move(json_data);
+    next_item_ = 0;
+    stage_ = LoadStage::Tilesets;
+}
+
+bool LevelLoader::update(float budget_ms) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::LOADER);
+    if (!isLoading()) return true;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Uint64 budget = static_cast<Uint64>(budget_ms / 1000.0 * SDL_GetPerformanceFrequency());
+    auto out_of_budget = [&] { return budget_ms > 0.0f && SDL_GetPerformanceCounter() - start > budget; };
+
+    // 每一步是读取地图、一批 tileset（并行）、一批瓦片解码任务（并行）、一个图层或一块对象，
+    // 每批的任务数等于工作线程数；至少执行一步，保证总能前进
+    const std::size_t batch_size = engine::utils::workerCount();
+    try {
+        do {
+            if (stage_ == LoadStage::Parse) {
+                parseLevel();
+            } else if (stage_ == LoadStage::Tilesets) {
+                const std::size_t end = std::min(next_item_ + batch_size, pending_tilesets_.size());
+                loadTilesets(next_item_, end);
+                done_work_ += end - next_item_;
+                next_item_ = end;
+                if (end >= pending_tilesets_.size()) {
+                    prepareDecode();
+                    stage_ = LoadStage::Decode;
+                }
+            } else if (stage_ == LoadStage::Decode) {
+                const std::size_t end = std::min(next_item_ + batch_size, decode_jobs_.size());
+                decodeTileChunks(next_item_, end);
+                next_item_ = end;
+                if (end >= decode_jobs_.size()) {
+                    decode_jobs_.clear();
+                    next_item_ = 0;
+                    stage_ = LoadStage::Layers;
+                }
+            } else {
+                stepLayer();
+            }
+        } while (isLoading() && !out_of_budget());
+    } catch (const std::exception& e) {     // 包括工作线程中抛出、由 parallelFor 转交的异常
+        spdlog::error("关卡 '{}' 加载失败: {}", map_path_, e.what());
+        failLevel();
+    }
+
+    return !isLoading();
+}
+
+float LevelLoader::getProgress() const {
+    if (stage_ == LoadStage::Done) return 1.0f;
+    return total_work_ == 0 ? 0.0f : static_cast<float>(done_work_) / static_cast<float>(total_work_);
+}
+
+void LevelLoader::stepLayer() {
+    const auto& layers = map_json_["layers"];
+    if (next_layer_ >= layers.size()) {
+        finishLevel();
+        return;
+    }
+    const auto& layer_json = layers[next_layer_];
+    if (!layer_json.value("visible", true)) {
+        spdlog::info("图层 '{}' 不可见，跳过加载。", layer_json.value("name", "Unnamed"));
+        finishLayer();
+        return;
+    }
+
+    // 根据图层类型决定加载方法
+    std::string layer_type = layer_json.value("type", "none");
+    if (layer_type == "imagelayer") {
+        loadImageLayer(layer_json, *scene_);
+        ++done_work_;
+        finishLayer();
+    } else if (layer_type == "tilelayer") {
+        // 瓦片已在 Decode 阶段解码，这里只创建图层对象
+        addTileLayer(layer_json, std::move(decoded_layers_[next_layer_]), *scene_);     // 瓦片已在解码时计入进度
+        finishLayer();
+    } else if (layer_type == "objectgroup") {
+        const std::size_t count = arraySize(layer_json, "objects");
+        const std::size_t end = std::min(next_item_ + OBJECT_CHUNK_SIZE, count);
+        loadObjectLayer(layer_json, next_item_, end, *scene_);
+        done_work_ += end - next_item_;
+        next_item_ = end;
+        if (end >= count) finishLayer();
+    } else {
+        spdlog::warn("不支持的图层类型: {}", layer_type);
+        finishLayer();
+    }
+}
+
+void LevelLoader::finishLayer() {
+    ++next_layer_;
+    next_item_ = 0;
+}
+
+void LevelLoader::failLevel() {
+    stage_ = LoadStage::Failed;
+    map_json_ = nlohmann::json();
+    pending_tilesets_.clear();
+    decoded_layers_.clear();
+    decode_jobs_.clear();
+    scene_ = nullptr;
+}
+
+void LevelLoader::finishLevel() {
+    stage_ = LoadStage::Done;
+    map_json_ = nlohmann::json();       // 地图数据只在加载期间需要（tileset_data_ 保留，热重载与对象查询需要）
+    pending_tilesets_.clear();
+    decoded_layers_.clear();
+    decode_jobs_.clear();
+    scene_ = nullptr;
+    spdlog::info("关卡加载完成: {}", map_path_);
+}
+
+bool LevelLoader::reloadLayers(Scene& scene) {
+    if (map_path_.empty()) return false;
+    if (isLoading()) return false;      // 增量加载尚未结束
+    nlohmann::json json_data;
+    asset_pack_ = nullptr;              // 热重载读取磁盘上修改后的散文件
+    if (!parseMap(std::string(map_path_), json_data)) return false;    // 失败时保留当前图层
+    try {
+        loadTilesets(0, pending_tilesets_.size());
+    } catch (const std::exception& e) {
+        spdlog::error("热重载 tileset 失败: {}", e.what());
+        return false;
+    }
+    if (!json_data.contains("layers") || !json_data["layers"].is_array()) return false;
+
+    for (const auto& layer_json : json_data["layers"]) {
+        if (!layer_json.value("visible", true)) continue;
+        std::string layer_type = layer_json.value("type", "none");
+        std::string layer_name = layer_json.value("name", "Unnamed");
+        auto* game_object = scene.findGameObjectByName(layer_name);
+
+        if (layer_type == "imagelayer") {
+            auto* pc = game_object ? game_object->getComponent<engine::component::ParallaxComponent>() : nullptr;
+            if (!pc) {                  // 新增的图层
+                loadImageLayer(layer_json, scene);
+                continue;
+            }
+            std::string image_path = layer_json.value("image", "");
+            if (image_path.empty()) continue;
+            pc->setSprite(engine::render::Sprite(resolvePath(image_path, map_path_)));
+            pc->setScrollFactor(glm::vec2(layer_json.value("parallaxx", 1.0f), layer_json.value("parallaxy", 1.0f)));
+            pc->setRepeat(glm::bvec2(layer_json.value("repeatx", false), layer_json.value("repeaty", false)));
+            if (auto* tc = game_object->getComponent<engine::component::TransformComponent>(); tc) {
+                tc->setPosition(glm::vec2(layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f)));
+            }
+        } else if (layer_type == "tilelayer") {
+            auto* tlc = game_object ? game_object->getComponent<engine::component::TileLayerComponent>() : nullptr;
+            if (!tlc) {
+                loadTileLayer(layer_json, scene);
+                continue;
+            }
+            if (!layer_json.contains("data") || !layer_json["data"].is_array()) continue;
+            std::vector<engine::component::TileInfo> tiles;
+            tiles.reserve(map_size_.x * map_size_.y);
+            for (const auto& gid : layer_json["data"]) {
+                tiles.push_back(getTileInfoByGid(gid));
+            }
+            tlc->setTiles(tile_size_, map_size_, std::move(tiles));
+        }
+        // 对象图层会生成带状态的游戏对象（生命值、物理等），热重载时不重新生成
+    }
+    spdlog::info("关卡图层热重载完成: {}", map_path_);
+    return true;
+}
+
+bool LevelLoader::dependsOn(std::string_view file_path) const {
+    std::error_code ec;
+    const auto target = std::filesystem::weakly_canonical(std::filesystem::path(file_path), ec);
+    if (ec || map_path_.empty()) return false;
+    auto same = [&](const std::string& path) {
+        std::error_code path_ec;
+        return std::filesystem::weakly_canonical(std::filesystem::path(path), path_ec) == target && !path_ec;
+    };
+    if (same(map_path_)) return true;
+    for (const auto& [first_gid, tileset] : tileset_data_) {
+        if (same(tileset.value("file_path", ""))) return true;
+    }
+    return false;
+}
+
+bool LevelLoader::parseMap(std::string_view level_path, nlohmann::json& json_data) {
+    // 1. 加载 JSON 文件（优先资源包）
+    auto text = readText(asset_pack_, level_path);
+    if (!text) {
         spdlog::error("无法打开关卡文件: {}", level_path);
         return false;
     }
 
     // 2. 解析 JSON 数据
-    nlohmann::json json_data;
     try {
-        file >> json_data;
+        json_data = nlohmann::json::parse(*text);
     } catch (const nlohmann::json::parse_error& e) {
         spdlog::error("解析 JSON 数据失败: {}", e.what());
         return false;
@@ -46,7 +299,8 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
     map_size_ = glm::ivec2(json_data.value("width", 0), json_data.value("height", 0));
     tile_size_ = glm::ivec2(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
 
-    // 4. 加载 tileset 数据
+    // 4. 记录待加载的 tileset（由 loadTilesets() 加载）
+    pending_tilesets_.clear();
     if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
         for (const auto& tileset_json : json_data["tilesets"]) {
             if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
@@ -55,37 +309,9 @@ bool LevelLoader::loadLevel(std::string_view level_path, Scene& scene) {
                 continue;
             }
             auto tileset_path = resolvePath(tileset_json["source"].get<std::string>(), map_path_);  // 支持隐式转换，可以省略.get<T>()方法，
-            auto first_gid = tileset_json["firstgid"];
-            loadTileset(tileset_path, first_gid);
-        }
-    }
-
-    // 5. 加载图层数据
-    if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
-        spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
-        return false;
-    }
-    for (const auto& layer_json : json_data["layers"]) {
-        // 获取各图层对象中的类型（type）字段
-        std::string layer_type = layer_json.value("type", "none");
-        if (!layer_json.value("visible", true)) {
-            spdlog::info("图层 '{}' 不可见，跳过加载。", layer_json.value("name", "Unnamed"));
-            continue;
-        }
-
-        // 根据图层类型决定加载方法
-        if (layer_type == "imagelayer") {       
-            loadImageLayer(layer_json, scene);
-        } else if (layer_type == "tilelayer") {
-            loadTileLayer(layer_json, scene);
-        } else if (layer_type == "objectgroup") {
-            loadObjectLayer(layer_json, scene);
-        } else {
-            spdlog::warn("不支持的图层类型: {}", layer_type);
+            pending_tilesets_.emplace_back(std::move(tileset_path), tileset_json["firstgid"].get<int>());
         }
     }
-
-    spdlog::info("关卡加载完成: {}", level_path);
     return true;
 }
 
@@ -131,14 +357,15 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, Scene& scene)
     std::vector<engine::component::TileInfo> tiles;
     tiles.reserve(map_size_.x * map_size_.y);
 
-    // 获取图层数据 (瓦片 ID 列表)
-    const auto& data = layer_json["data"];
-
     // 根据gid获取必要信息，并依次填充 TileInfo Vector
-    for (const auto& gid : data) {
+    for (const auto& gid : layer_json["data"]) {
         tiles.push_back(getTileInfoByGid(gid));
     }
+    addTileLayer(layer_json, std::move(tiles), scene);
+}
 
+void LevelLoader::addTileLayer(const nlohmann::json& layer_json, std::vector<engine::component::TileInfo>&& tiles, Scene& scene)
+{
     // 获取图层名称
     std::string layer_name = layer_json.value("name", "Unnamed");
     // 创建游戏对象
@@ -150,7 +377,7 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, Scene& scene)
     spdlog::info("加载瓦片图层: '{}' 完成", layer_name);
 }
 
-void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene)
+void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, std::size_t begin, std::size_t end, Scene& scene)
 {
     if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
         spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_json.value("name", "Unnamed"));
@@ -158,8 +385,9 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
     }
     // 获取对象数据
     const auto& objects = layer_json["objects"];
-    // 遍历对象数据
-    for (const auto& object : objects) {
+    // 遍历 [begin, end) 范围内的对象数据
+    for (std::size_t i = begin; i < end && i < objects.size(); ++i) {
+        const auto& object = objects[i];
         // 获取对象gid
         auto gid = object.value("gid", 0);
         if (gid == 0) {     // 如果gid为0 (即不存在)，则代表自己绘制的形状
@@ -178,22 +406,15 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
                 auto game_object = std::make_unique<engine::object::GameObject>(object_name);
                     // 获取Transform相关信息 （自定义形状的坐标针对左上角）
                 auto position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
-                auto dst_size = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
                 auto rotation = object.value("rotation", 0.0f);
                     // 添加TransformComponent，缩放为设定为1.0f
+                    // (本项目没有碰撞/物理组件，自定义形状只作为带标签的区域标记)
                 game_object->addComponent<engine::component::TransformComponent>(position, glm::vec2(1.0f), rotation);
 
-                // --- 添加碰撞组件和物理组件 ---
-                    // 碰撞盒大小与dst_size相同 
-                auto collider = std::make_unique<engine::physics::AABBCollider>(dst_size);
-                auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    // 自定义形状通常是trigger类型，除非显示指定 （因此默认为真）
-                cc->setTrigger(object.value("trigger", true));
-                    // 添加物理组件，不受重力影响
-                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-                
-                // 获取标签信息并设置
-                if (auto tag = getTileProperty<std::string>(object, "tag"); tag) {  // 如果有标签
+                // 获取标签信息并设置（对象自身的属性同样放入属性表查询）
+                auto properties = object.contains("properties") ? tile_properties_.intern(object["properties"])
+                                                                : engine::loader::TilePropertyTable::EMPTY;
+                if (auto tag = getTileProperty<std::string>(properties, "tag"); tag) {  // 如果有标签
                     game_object->setTag(tag.value());
                 }
                 // 添加到场景
@@ -229,58 +450,23 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
             game_object->addComponent<engine::component::TransformComponent>(position, scale, rotation);
             game_object->addComponent<engine::component::SpriteComponent>(std::move(tile_info.sprite), scene.getContext().getResourceManager());
 
-            // 获取瓦片json信息      1. 必然存在，因为getTileInfoByGid(gid)函数已经顺利执行
-                                // 2. 这里再获取json，实际上检索了两次，未来可以优化
-            auto tile_json_opt = getTileJsonByGid(gid);
-            if (!tile_json_opt) {
-                spdlog::error("gid为 {} 的瓦片没有对应的 JSON 数据。", gid);
-                continue;
-            }
-            auto& tile_json = tile_json_opt.value();
-
-            // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
-            if (tile_info.type == engine::component::TileType::SOLID) {
-                auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
-                game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                // 物理组件不受重力影响
-                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-                // 设置标签方便物理引擎检索
-                game_object->setTag("solid");
-            }
-            // 如果非SOLID类型，检查自定义碰撞盒是否存在
-            else if (auto rect = getColliderRect(tile_json); rect) {  
-                // 如果有，添加碰撞组件
-                auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
-                auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                cc->setOffset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
-                // 和物理组件（默认不受重力影响）
-                game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-            }
+            // 瓦片的自定义属性（加载 tileset 时已放入属性表，这里只查询索引，不再检索json）
+            const auto properties = tile_info.properties;
 
-            // 获取标签信息并设置
-            auto tag = getTileProperty<std::string>(tile_json, "tag");
+            // 获取标签信息并设置 (本项目没有碰撞/物理组件，瓦片类型只用于默认标签)
+            auto tag = getTileProperty<std::string>(properties, "tag");
             if (tag) {
                 game_object->setTag(tag.value());
             }
-            // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
-            else if (tile_info.type == engine::component::TileType::HAZARD) {
+            // 没有手动设置标签时，SOLID 与危险瓦片分别自动设置为 "solid" / "hazard"
+            else if (tile_info.type == engine::component::TileType::SOLID) {
+                game_object->setTag("solid");
+            } else if (tile_info.type == engine::component::TileType::HAZARD) {
                 game_object->setTag("hazard");
             }
 
-            // 获取重力信息并设置
-            auto gravity = getTileProperty<bool>(tile_json, "gravity");
-            if (gravity) {
-                auto pc = game_object->getComponent<engine::component::PhysicsComponent>();
-                if (pc) {
-                    pc->setUseGravity(gravity.value());
-                } else {
-                    spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object_name);
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), gravity.value());
-                }
-            }
-
             // 获取动画信息并设置
-            auto anim_string = getTileProperty<std::string>(tile_json, "animation");
+            auto anim_string = getTileProperty<std::string>(properties, "animation");
             if (anim_string) {
                 // 解析string为JSON对象
                 nlohmann::json anim_json;
@@ -297,7 +483,7 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
             }
 
             // 获取音效信息并设置
-            auto sound_string = getTileProperty<std::string>(tile_json, "sound");
+            auto sound_string = getTileProperty<std::string>(properties, "sound");
             if (sound_string) {
                 // 解析string为JSON对象
                 nlohmann::json sound_json;
@@ -315,7 +501,7 @@ void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene
             }
 
             // 获取生命值信息并设置
-            auto health = getTileProperty<int>(tile_json, "health");
+            auto health = getTileProperty<int>(properties, "health");
             if (health) {
                 // 添加 HealthComponent
                 game_object->addComponent<engine::component::HealthComponent>(health.value());
@@ -396,82 +582,45 @@ void LevelLoader::addSound(const nlohmann::json &sound_json, engine::component::
     }
 }
 
-std::optional<engine::utils::Rect> LevelLoader::getColliderRect(const nlohmann::json &tile_json)
+engine::component::TileType LevelLoader::getTileType(engine::loader::TilePropertyTable::Index properties) const
 {
-    if (!tile_json.contains("objectgroup")) return std::nullopt;
-    auto& objectgroup = tile_json["objectgroup"];
-    if (!objectgroup.contains("objects")) return std::nullopt;
-    auto& objects = objectgroup["objects"];
-    for (const auto& object : objects) {    // 一个图片只支持一个碰撞器。如果有多个，则返回第一个不为空的
-        auto rect = engine::utils::Rect(glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f)), 
-                                        glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f)));
-        if (rect.size.x > 0 && rect.size.y > 0) {
-            return rect;
-        }
+    if (properties == engine::loader::TilePropertyTable::EMPTY) {
+        return engine::component::TileType::NORMAL;
     }
-    return std::nullopt;    // 如果没找到碰撞器，则返回空
-}
-
-engine::component::TileType LevelLoader::getTileType(const nlohmann::json &tile_json)
-{
-    if (tile_json.contains("properties")) {
-        auto& properties = tile_json["properties"];
-        for (auto& property : properties) {
-            if (property.contains("name") && property["name"] == "solid") {
-                auto is_solid = property.value("value", false);
-                return is_solid ? engine::component::TileType::SOLID : engine::component::TileType::NORMAL;
-            }
-            else if (property.contains("name") && property["name"] == "slope") {
-                auto slope_type = property.value("value", "");
-                if (slope_type == "0_1") {
-                    return engine::component::TileType::SLOPE_0_1;
-                } else if (slope_type == "1_0") {
-                    return engine::component::TileType::SLOPE_1_0;
-                } else if (slope_type == "0_2") {
-                    return engine::component::TileType::SLOPE_0_2;
-                } else if (slope_type == "2_0") {
-                    return engine::component::TileType::SLOPE_2_0;
-                } else if (slope_type == "2_1") {
-                    return engine::component::TileType::SLOPE_2_1;
-                } else if (slope_type == "1_2") {
-                    return engine::component::TileType::SLOPE_1_2;
-                } else {
-                    spdlog::error("未知的斜坡类型: {}", slope_type);
-                    return engine::component::TileType::NORMAL;
-                }
-            }
-            else if (property.contains("name") && property["name"] == "unisolid") {
-                auto is_unisolid = property.value("value", false);
-                return is_unisolid ? engine::component::TileType::UNISOLID : engine::component::TileType::NORMAL;
-            }
-            else if (property.contains("name") && property["name"] == "hazard") {
-                auto is_hazard = property.value("value", false);
-                return is_hazard ? engine::component::TileType::HAZARD : engine::component::TileType::NORMAL;
-            }
-            else if (property.contains("name") && property["name"] == "ladder") {
-                auto is_ladder = property.value("value", false);
-                return is_ladder ? engine::component::TileType::LADDER : engine::component::TileType::NORMAL;
-            }
-            // TODO: 可以在这里添加更多的自定义属性处理逻辑
-        }
+    if (auto is_solid = getTileProperty<bool>(properties, "solid"); is_solid) {
+        return *is_solid ? engine::component::TileType::SOLID : engine::component::TileType::NORMAL;
     }
-    return engine::component::TileType::NORMAL;
-}
-
-engine::component::TileType LevelLoader::getTileTypeById(const nlohmann::json &tileset_json, int local_id)
-{
-    if (tileset_json.contains("tiles")) {
-        auto& tiles = tileset_json["tiles"];
-        for (auto& tile : tiles) {
-            if (tile.contains("id") && tile["id"] == local_id) {
-                return getTileType(tile);
-            }
+    if (auto slope_type = getTileProperty<std::string>(properties, "slope"); slope_type) {
+        if (*slope_type == "0_1") {
+            return engine::component::TileType::SLOPE_0_1;
+        } else if (*slope_type == "1_0") {
+            return engine::component::TileType::SLOPE_1_0;
+        } else if (*slope_type == "0_2") {
+            return engine::component::TileType::SLOPE_0_2;
+        } else if (*slope_type == "2_0") {
+            return engine::component::TileType::SLOPE_2_0;
+        } else if (*slope_type == "2_1") {
+            return engine::component::TileType::SLOPE_2_1;
+        } else if (*slope_type == "1_2") {
+            return engine::component::TileType::SLOPE_1_2;
         }
+        spdlog::error("未知的斜坡类型: {}", *slope_type);
+        return engine::component::TileType::NORMAL;
     }
+    if (auto is_unisolid = getTileProperty<bool>(properties, "unisolid"); is_unisolid) {
+        return *is_unisolid ? engine::component::TileType::UNISOLID : engine::component::TileType::NORMAL;
+    }
+    if (auto is_hazard = getTileProperty<bool>(properties, "hazard"); is_hazard) {
+        return *is_hazard ? engine::component::TileType::HAZARD : engine::component::TileType::NORMAL;
+    }
+    if (auto is_ladder = getTileProperty<bool>(properties, "ladder"); is_ladder) {
+        return *is_ladder ? engine::component::TileType::LADDER : engine::component::TileType::NORMAL;
+    }
+    // TODO: 可以在这里添加更多的自定义属性处理逻辑
     return engine::component::TileType::NORMAL;
 }
 
-engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
+engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid) const
 {
     if (gid == 0) {
         return engine::component::TileInfo();
@@ -487,15 +636,15 @@ engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
 
     const auto& tileset = tileset_it->second;
     auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-    std::string file_path = tileset.value("file_path", "");       // 获取图块集文件路径
-    if (file_path.empty()) {
-        spdlog::error("Tileset 文件 '{}' 缺少 'file_path' 属性。", tileset_it->first);
-        return engine::component::TileInfo();
+    // 自定义属性（只记录属性表中的索引，同一图块瓦片的所有实例共享），瓦片类型也由它决定
+    auto properties = engine::loader::TilePropertyTable::EMPTY;
+    if (auto it = tile_property_index_.find(gid); it != tile_property_index_.end()) {
+        properties = it->second;
     }
     // 图块集分为两种情况，需要分别考虑
-    if (tileset.contains("image")) {    // 这是单一图片的情况
-        // 获取图片路径
-        auto texture_id = resolvePath(tileset["image"].get<std::string>(), file_path);
+    if (tileset.contains("image_path")) {    // 这是单一图片的情况
+        // 获取图片路径（读取 tileset 时已解析）
+        const auto& texture_id = tileset["image_path"].get_ref<const std::string&>();
         // 计算瓦片在图片网格中的坐标
         auto coordinate_x = local_id % tileset["columns"].get<int>();
         auto coordinate_y = local_id / tileset["columns"].get<int>();
@@ -507,8 +656,7 @@ engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
             static_cast<float>(tile_size_.y)
         };
         engine::render::Sprite sprite{texture_id, texture_rect};
-        auto tile_type = getTileTypeById(tileset, local_id);   // 获取瓦片类型（只有瓦片id，还没找具体瓦片json）
-        return engine::component::TileInfo(sprite, tile_type);
+        return engine::component::TileInfo(sprite, getTileType(properties), properties);
     } else {   // 这是多图片的情况
         if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空的瓦片信息
             spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
@@ -519,13 +667,13 @@ engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
         for (const auto& tile_json : tiles_json) {
             auto tile_id = tile_json.value("id", 0);
             if (tile_id == local_id) {   // 找到对应的瓦片，进行后续操作
-                if (!tile_json.contains("image")) {   // 没有image字段的话不符合数据格式要求，直接返回空的瓦片信息
+                if (!tile_json.contains("image_path")) {   // 没有image字段的话不符合数据格式要求，直接返回空的瓦片信息
                     spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_it->first, tile_id);
                     return engine::component::TileInfo();
                 }
                 // --- 接下来根据必要信息创建并返回 TileInfo ---
-                // 获取图片路径
-                auto texture_id = resolvePath(tile_json["image"].get<std::string>(), file_path);
+                // 获取图片路径（读取 tileset 时已解析）
+                const auto& texture_id = tile_json["image_path"].get_ref<const std::string&>();
                 // 先确认图片尺寸
                 auto image_width = tile_json.value("imagewidth", 0);
                 auto image_height = tile_json.value("imageheight", 0);
@@ -537,8 +685,7 @@ engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
                     static_cast<float>(tile_json.value("height", image_height))
                 };
                 engine::render::Sprite sprite{texture_id, texture_rect};
-                auto tile_type = getTileType(tile_json);    // 获取瓦片类型（已经有具体瓦片json了）
-                return engine::component::TileInfo(sprite, tile_type);
+                return engine::component::TileInfo(sprite, getTileType(properties), properties);
             }
         }
     }
@@ -547,52 +694,110 @@ engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
     return engine::component::TileInfo();
 }
 
-std::optional<nlohmann::json> LevelLoader::getTileJsonByGid(int gid) const
+void LevelLoader::loadTilesets(std::size_t begin, std::size_t end)
 {
-    // 1. 查找tileset_data_中键小于等于gid的最近元素
-    auto tileset_it = tileset_data_.upper_bound(gid);
-    if (tileset_it == tileset_data_.begin()) {
-        spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
-        return std::nullopt;
+    // 各 tileset 文件互不依赖，由工作线程并行读取解析，每个任务只写自己的结果槽
+    std::vector<std::optional<nlohmann::json>> results(end - begin);
+    engine::utils::parallelFor(results.size(), [&](std::size_t i) {
+        results[i] = readTileset(asset_pack_, pending_tilesets_[begin + i].first);
+    });
+
+    // 主线程按地图中的顺序合并 (从第一个开始加载时先清空旧数据；读取抛出异常时旧数据保持不变)
+    if (begin == 0) {
+        tileset_data_.clear();
+        tile_properties_.clear();
+        tile_property_index_.clear();
     }
-    --tileset_it;
-    // 2. 获取图块集json对象
-    const auto& tileset = tileset_it->second;
-    auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-    if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空
-        spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
-        return std::nullopt;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (!results[i]) continue;
+        const auto& [tileset_path, first_gid] = pending_tilesets_[begin + i];
+        internTileProperties(*results[i], first_gid);
+        tileset_data_[first_gid] = std::move(*results[i]);
+        spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
     }
-    // 3. 遍历tiles数组，根据id查找对应的瓦片并返回瓦片json
-    const auto& tiles_json = tileset["tiles"];
-    for (const auto& tile_json : tiles_json) {
-        auto tile_id = tile_json.value("id", 0);
-        if (tile_id == local_id) {   // 找到对应的瓦片，返回瓦片json
-            return tile_json;
+}
+
+void LevelLoader::internTileProperties(const nlohmann::json& tileset_json, int first_gid)
+{
+    auto it = tileset_json.find("tiles");
+    if (it == tileset_json.end() || !it->is_array()) return;
+    for (const auto& tile_json : *it) {
+        if (!tile_json.contains("properties")) continue;
+        auto index = tile_properties_.intern(tile_json["properties"]);
+        if (index != engine::loader::TilePropertyTable::EMPTY) {
+            tile_property_index_[first_gid + tile_json.value("id", 0)] = index;
         }
     }
-    return std::nullopt;
 }
 
-void LevelLoader::loadTileset(std::string_view tileset_path, int first_gid)
+std::optional<nlohmann::json> LevelLoader::readTileset(const engine::resource::AssetPack* pack, const std::string& tileset_path)
 {
-    auto path = std::filesystem::path(tileset_path);
-    std::ifstream tileset_file(path);
-    if (!tileset_file.is_open()) {
+    auto text = readText(pack, tileset_path);
+    if (!text) {
         spdlog::error("无法打开 Tileset 文件: {}", tileset_path);
-        return;
+        return std::nullopt;
     }
 
     nlohmann::json ts_json;
     try {
-        tileset_file >> ts_json;
+        ts_json = nlohmann::json::parse(*text);
     } catch (const nlohmann::json::parse_error& e) {
         spdlog::error("解析 Tileset JSON 文件 '{}' 失败: {} (at byte {})", tileset_path, e.what(), e.byte);
-        return;
+        return std::nullopt;
+    }
+    ts_json["file_path"] = tileset_path;    // 将文件路径存储到json中，热重载时需要
+
+    // 图片路径在这里解析一次（每个 tileset 或每个瓦片id一次），解码瓦片时只需查找，不再访问文件系统
+    if (auto it = ts_json.find("image"); it != ts_json.end() && it->is_string()) {
+        ts_json["image_path"] = resolvePath(it->get_ref<const std::string&>(), tileset_path);
+    }
+    if (auto tiles = ts_json.find("tiles"); tiles != ts_json.end() && tiles->is_array()) {
+        for (auto& tile_json : *tiles) {
+            if (auto it = tile_json.find("image"); it != tile_json.end() && it->is_string()) {
+                tile_json["image_path"] = resolvePath(it->get_ref<const std::string&>(), tileset_path);
+            }
+        }
+    }
+    return ts_json;
+}
+
+void LevelLoader::prepareDecode()
+{
+    // 为每个可见瓦片图层准备结果，并切分为固定大小的解码任务 (图层下标, 起始瓦片)
+    const auto& layers = map_json_["layers"];
+    decoded_layers_.clear();
+    decoded_layers_.resize(layers.size());
+    decode_jobs_.clear();
+    next_item_ = 0;
+    for (std::size_t layer = 0; layer < layers.size(); ++layer) {
+        const auto& layer_json = layers[layer];
+        if (!layer_json.value("visible", true) || layer_json.value("type", "none") != "tilelayer") continue;
+        const std::size_t count = arraySize(layer_json, "data");
+        decoded_layers_[layer].resize(count);
+        for (std::size_t begin = 0; begin < count; begin += DECODE_CHUNK_SIZE) {
+            decode_jobs_.emplace_back(layer, begin);
+        }
+    }
+}
+
+void LevelLoader::decodeTileChunks(std::size_t begin, std::size_t end)
+{
+    // 并行解码：tileset_data_、属性表与 map_json_ 此时只读，每个任务只写自己负责的瓦片槽，
+    // 因此结果的顺序与地图中的顺序一致，与线程调度无关
+    const auto& layers = map_json_["layers"];
+    engine::utils::parallelFor(end - begin, [&](std::size_t job) {
+        const auto [layer, first] = decode_jobs_[begin + job];
+        const auto& data = layers[layer]["data"];
+        auto& tiles = decoded_layers_[layer];
+        const std::size_t last = std::min(first + DECODE_CHUNK_SIZE, tiles.size());
+        for (std::size_t index = first; index < last; ++index) {
+            tiles[index] = getTileInfoByGid(data[index].get<int>());
+        }
+    });
+    for (std::size_t job = begin; job < end; ++job) {
+        const auto [layer, first] = decode_jobs_[job];
+        done_work_ += std::min(DECODE_CHUNK_SIZE, decoded_layers_[layer].size() - first);
     }
-    ts_json["file_path"] = tileset_path;    // 将文件路径存储到json中，后续解析图片路径时需要
-    tileset_data_[first_gid] = std::move(ts_json);
-    spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
 }
 
 std::string LevelLoader::resolvePath(std::string_view relative_path, std::string_view file_path)
@@ -602,7 +807,8 @@ std::string LevelLoader::resolvePath(std::string_view relative_path, std::string
     auto map_dir = std::filesystem::path(file_path).parent_path();
     // 合并路径（相对于可执行文件）并返回。 /* std::filesystem::canonical：解析路径中的当前目录（.）和上级目录（..）导航符，
                                       /*  得到一个干净的路径 */
-    auto final_path = std::filesystem::canonical(map_dir / relative_path);
+    // 使用 weakly_canonical：只打包发布、磁盘上没有散文件时也能得到规范化的路径，供资源包查找
+    auto final_path = std::filesystem::weakly_canonical(map_dir / relative_path);
     return final_path.string();
     } catch (const std::exception& e) {
         spdlog::error("解析路径失败: {}", e.what());
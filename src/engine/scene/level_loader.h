@@ -1,10 +1,16 @@
 #pragma once
+#include <cstddef>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
 #include <map>
 #include <optional>
+#include <unordered_map>
+#include <entt/core/hashed_string.hpp>
+#include "../loader/tile_property_table.h"
 #include "../utils/math.h"
 
 namespace engine::component {
@@ -14,20 +20,56 @@ struct TileInfo;
 enum class TileType;
 }
 
+namespace engine::resource {
+class AssetPack;
+}
+
 namespace engine::scene {
 class Scene;
 
 /**
  * @brief 负责从 Tiled JSON 文件 (.tmj) 加载关卡数据到 Scene 中。
+ *
+ * 支持增量加载：beginLevel() 只记录地图路径，之后每帧调用 update(budget_ms)，
+ * 在时间预算内依次完成地图文件的读取、tileset（按批）、瓦片解码（按批）、各图层（对象按块）的加载，
+ * 每步之间检查预算，加载期间界面保持流畅。loadLevel() 等价于 beginLevel() 后不限时间地执行 update()。
+ * 每批 tileset 文件的读取解析、每批瓦片的 gid 解码由工作线程并行完成（只读 tileset_data_，
+ * 不访问 ResourceManager 等共享状态，纹理由渲染时按 Sprite 的纹理ID在主线程加载），
+ * 结果按图层下标保存，游戏对象仍在主线程按地图顺序创建，与串行加载完全一致。
+ * 图块集中瓦片的自定义属性在加载 tileset 时转换到 TilePropertyTable，TileInfo::properties 只保存其索引。
  */
 class LevelLoader final {
+public:
+    static constexpr std::size_t DECODE_CHUNK_SIZE = 1024;  ///< @brief 每个解码任务处理的瓦片数量
+    static constexpr std::size_t OBJECT_CHUNK_SIZE = 16;    ///< @brief 每步创建的对象数量
+
+private:
+    /// @brief 增量加载的阶段
+    enum class LoadStage { Idle, Parse, Tilesets, Decode, Layers, Done, Failed };
+
     std::string map_path_;      ///< @brief 地图路径（拼接路径时需要）
     glm::ivec2 map_size_;       ///< @brief 地图尺寸(瓦片数量)
     glm::ivec2 tile_size_;      ///< @brief 瓦片尺寸(像素)
     std::map<int, nlohmann::json> tileset_data_;    ///< @brief firstgid -> 瓦片集数据
+    engine::loader::TilePropertyTable tile_properties_;     ///< @brief 所有图块瓦片（及对象）的自定义属性
+    std::unordered_map<int, engine::loader::TilePropertyTable::Index> tile_property_index_;   ///< @brief gid -> 属性集索引
+    const engine::resource::AssetPack* asset_pack_ = nullptr;   ///< @brief 读取地图与 tileset 的资源包（nullptr 表示直接读取磁盘散文件，热重载用）
+
+    // --- 增量加载状态 ---
+    Scene* scene_ = nullptr;                                    ///< @brief 正在加载的场景（非拥有）
+    LoadStage stage_ = LoadStage::Idle;                         ///< @brief 当前阶段
+    nlohmann::json map_json_;                                   ///< @brief 正在加载的地图数据（完成后释放）
+    std::vector<std::pair<std::string, int>> pending_tilesets_; ///< @brief 待加载的 tileset (路径, firstgid)
+    std::size_t next_layer_ = 0;                                ///< @brief 正在加载的图层索引
+    std::size_t next_item_ = 0;                                 ///< @brief 当前阶段中下一个 tileset/解码任务（或当前图层中下一个对象）的索引
+    std::vector<std::pair<std::size_t, std::size_t>> decode_jobs_;  ///< @brief 待执行的解码任务 (图层下标, 起始瓦片)
+    std::vector<std::vector<engine::component::TileInfo>> decoded_layers_;  ///< @brief 图层下标 -> 解码好的瓦片（非瓦片图层为空）
+    std::size_t total_work_ = 0;                                ///< @brief 总工作量（tileset + 图片图层 + 瓦片 + 对象）
+    std::size_t done_work_ = 0;                                 ///< @brief 已完成的工作量
 
 public:
-    LevelLoader() = default;
+    LevelLoader();
+    ~LevelLoader();
 
     /**
      * @brief 加载关卡数据到指定的 Scene 对象中。
@@ -37,89 +79,143 @@ public:
      */
     [[nodiscard]] bool loadLevel(std::string_view map_path, Scene& scene);
 
-private:
-    void loadImageLayer(const nlohmann::json& layer_json, Scene& scene);    ///< @brief 加载图片图层
-    void loadTileLayer(const nlohmann::json& layer_json, Scene& scene);     ///< @brief 加载瓦片图层
-    void loadObjectLayer(const nlohmann::json& layer_json, Scene& scene);   ///< @brief 加载对象图层
-
     /**
-     * @brief 添加动画到指定的 AnimationComponent。
-     * @param anim_json 动画json数据（自定义）
-     * @param ac AnimationComponent 指针（动画添加到此组件）
-     * @param sprite_size 每一帧动画的尺寸
+     * @brief 开始增量加载：只记录地图路径，地图文件的读取与解析由之后的 update() 分帧完成。
+     * @param map_path Tiled JSON 地图文件的路径。
+     * @param scene 要加载数据的目标 Scene 对象（加载结束前必须保持有效）。
+     * @return bool 路径是否有效（地图文件本身的错误在 update() 中发现，见 hasFailed()）。
      */
-    void addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const glm::vec2& sprite_size);
+    [[nodiscard]] bool beginLevel(std::string_view map_path, Scene& scene);
 
     /**
-     * @brief 添加音效到指定的 AudioComponent。
-     * @param sound_json 音效json数据（自定义）
-     * @param audio_component AudioComponent 指针（音效添加到此组件）
+     * @brief 在时间预算内继续加载（每帧调用）。
+     * @param budget_ms 本次可用的时间（毫秒），不大于0表示不限制。
+     * @return bool 加载是否已结束（成功或失败）。
      */
-    void addSound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component);
+    bool update(float budget_ms);
+
+    bool isLoading() const {                                            ///< @brief 是否正在增量加载
+        return stage_ == LoadStage::Parse || stage_ == LoadStage::Tilesets || stage_ == LoadStage::Decode ||
+               stage_ == LoadStage::Layers;
+    }
+    bool hasFailed() const { return stage_ == LoadStage::Failed; }      ///< @brief 加载是否失败
+    float getProgress() const;                                          ///< @brief 加载进度 (0~1)
+    const engine::loader::TilePropertyTable& getTileProperties() const { return tile_properties_; }   ///< @brief 获取瓦片属性表
 
     /**
-     * @brief 获取瓦片属性
+     * @brief 获取瓦片属性（从属性表中查询，TileInfo::properties 即为属性集索引）
      * @tparam T 属性类型
-     * @param tile_json 瓦片json数据
+     * @param properties 属性集索引
      * @param property_name 属性名称
      * @return 属性值，如果属性不存在则返回 std::nullopt
      */
     template<typename T>
-    std::optional<T> getTileProperty(const nlohmann::json& tile_json, std::string_view property_name) {
-        if (!tile_json.contains("properties")) return std::nullopt;
-        const auto& properties = tile_json["properties"];
-        for (const auto& property : properties) {
-            if (property.contains("name") && property["name"] == std::string(property_name)) {
-                if (property.contains("value")) {
-                    return property["value"].get<T>();
-                }
-            }
-        }
-        return std::nullopt;
+    std::optional<T> getTileProperty(engine::loader::TilePropertyTable::Index properties, std::string_view property_name) const {
+        return tile_properties_.get<T>(properties, entt::hashed_string::value(property_name.data(), property_name.size()));
     }
 
     /**
-     * @brief 获取瓦片碰撞器矩形
-     * @param tile_json 瓦片json数据
-     * @return 碰撞器矩形，如果碰撞器不存在则返回 std::nullopt
+     * @brief 热重载：重新读取地图与 tileset 文件，就地更新已加载的图片图层与瓦片图层（按图层名称匹配）。
+     * 对象图层不会重新生成；读取失败时保留当前图层。
+     * @param scene 已通过 loadLevel() 加载过本地图的场景。
+     * @return bool 是否重载成功。
      */
-    std::optional<engine::utils::Rect> getColliderRect(const nlohmann::json& tile_json);
+    bool reloadLayers(Scene& scene);
 
     /**
-     * @brief 根据瓦片json对象获取瓦片类型
-     * @param tile_json 瓦片json数据
-     * @return 瓦片类型
+     * @brief 已加载的关卡是否依赖该文件（地图本身或其 tileset），用于决定是否需要热重载。
      */
-    engine::component::TileType getTileType(const nlohmann::json& tile_json);
+    bool dependsOn(std::string_view file_path) const;
 
+private:
     /**
-     * @brief 根据（单一图片）图块集中的id获取瓦片类型
-     * @param tileset_json 图块集json数据
-     * @param local_id 图块集中的id
-     * @return 瓦片类型
+     * @brief 读取地图 JSON，记录地图信息与待加载的 tileset (加载的步骤 1-4)。
+     * @param json_data 输出的地图 JSON 数据。
      */
-    engine::component::TileType getTileTypeById(const nlohmann::json& tileset_json, int local_id);
+    bool parseMap(std::string_view level_path, nlohmann::json& json_data);
 
     /**
-     * @brief 根据全局 ID 获取瓦片信息。
-     * @param gid 全局 ID。
-     * @return engine::component::TileInfo 瓦片信息。
+     * @brief 读取地图文件，检查图层并统计总工作量（增量加载的第一步）；失败时进入失败状态。
      */
-    engine::component::TileInfo getTileInfoByGid(int gid);
+    void parseLevel();
 
     /**
-     * @brief 根据全局 ID 获取瓦片json对象 (用于对象层获取瓦片信息)
-     * @param gid 全局 ID
-     * @return 瓦片json对象
+     * @brief 并行读取并解析 pending_tilesets_ 中 [begin, end) 范围的 tileset 文件，按地图中的顺序保存到 tileset_data_。
+     * begin 为 0 时先清空已有的 tileset 数据与属性表。
      */
-    std::optional<nlohmann::json> getTileJsonByGid(int gid) const;
+    void loadTilesets(std::size_t begin, std::size_t end);
 
     /**
-     * @brief 加载 Tiled tileset 文件 (.tsj)。
+     * @brief 读取并解析单个 tileset 文件（不访问成员，可在工作线程中调用）。
+     * @param pack 资源包（挂载后只读，可在多个线程中同时读取）；nullptr 表示直接读取磁盘散文件。
      * @param tileset_path Tileset 文件路径。
-     * @param first_gid 此 tileset 的第一个全局 ID。
+     * @return 解析后的json（已记录 file_path，图片路径已解析到 image_path），失败返回 std::nullopt。
+     */
+    static std::optional<nlohmann::json> readTileset(const engine::resource::AssetPack* pack, const std::string& tileset_path);
+
+    /**
+     * @brief 为所有可见瓦片图层准备结果槽，并把瓦片切分为解码任务（每个 DECODE_CHUNK_SIZE 个瓦片）。
+     */
+    void prepareDecode();
+
+    /**
+     * @brief 用工作线程并行执行 decode_jobs_ 中 [begin, end) 范围的解码任务，结果按图层下标保存到 decoded_layers_。
+     */
+    void decodeTileChunks(std::size_t begin, std::size_t end);
+
+    void stepLayer();                                                       ///< @brief 执行当前图层的一步加载（一个图片图层或一块瓦片/对象）
+    void finishLayer();                                                     ///< @brief 完成当前图层，前进到下一个
+    void finishLevel();                                                     ///< @brief 完成加载，释放地图数据
+    void failLevel();                                                       ///< @brief 加载失败，释放地图数据
+
+    void loadImageLayer(const nlohmann::json& layer_json, Scene& scene);    ///< @brief 加载图片图层
+    void loadTileLayer(const nlohmann::json& layer_json, Scene& scene);     ///< @brief 串行解码并加载瓦片图层（热重载时新增的图层）
+
+    /**
+     * @brief 用已解码的瓦片创建瓦片图层对象。
+     */
+    void addTileLayer(const nlohmann::json& layer_json, std::vector<engine::component::TileInfo>&& tiles, Scene& scene);
+
+    /**
+     * @brief 加载对象图层中 [begin, end) 范围的对象。
+     */
+    void loadObjectLayer(const nlohmann::json& layer_json, std::size_t begin, std::size_t end, Scene& scene);
+
+    /**
+     * @brief 添加动画到指定的 AnimationComponent。
+     * @param anim_json 动画json数据（自定义）
+     * @param ac AnimationComponent 指针（动画添加到此组件）
+     * @param sprite_size 每一帧动画的尺寸
+     */
+    void addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const glm::vec2& sprite_size);
+
+    /**
+     * @brief 添加音效到指定的 AudioComponent。
+     * @param sound_json 音效json数据（自定义）
+     * @param audio_component AudioComponent 指针（音效添加到此组件）
+     */
+    void addSound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component);
+
+    /**
+     * @brief 把 tileset 中各瓦片的属性数组添加到属性表，并记录 gid -> 索引
+     * @param tileset_json 图块集json数据
+     * @param first_gid 此 tileset 的第一个全局 ID
+     */
+    void internTileProperties(const nlohmann::json& tileset_json, int first_gid);
+
+    /**
+     * @brief 根据瓦片的自定义属性获取瓦片类型
+     * @param properties 属性集索引
+     * @return 瓦片类型
+     */
+    engine::component::TileType getTileType(engine::loader::TilePropertyTable::Index properties) const;
+
+    /**
+     * @brief 根据全局 ID 获取瓦片信息（只读取 tileset_data_，可在工作线程中调用）。
+     * @param gid 全局 ID。
+     * @return engine::component::TileInfo 瓦片信息。
      */
-    void loadTileset(std::string_view tileset_path, int first_gid);
+    engine::component::TileInfo getTileInfoByGid(int gid) const;
 
     /**
      * @brief 解析图片路径，合并地图路径和相对路径。例如：
@@ -130,7 +226,7 @@ private:
      * @param file_path 文件路径
      * @return std::string 解析后的完整路径。
      */
-    std::string resolvePath(std::string_view relative_path, std::string_view file_path);
+    static std::string resolvePath(std::string_view relative_path, std::string_view file_path);
 };
 
 } // namespace engine::scene
\ No newline at end of file
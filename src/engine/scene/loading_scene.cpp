@@ -0,0 +1,86 @@
+#include "loading_scene.h"
+#include "scene_manager.h"
+#include "../core/context.h"
+#include "../core/frame_arena.h"
+#include "../render/camera.h"
+#include "../render/renderer.h"
+#include "../render/text_renderer.h"
+#include "../resource/preloader.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <charconv>
+#include <string>
+
+namespace engine::scene {
+
+namespace {
+constexpr std::string_view LOADING_FONT = "assets/fonts/VonwaonBitmap-16px.ttf";
+constexpr int LOADING_FONT_SIZE = 16;
+
+/// @brief 把整数追加到字符串末尾（不经过 std::to_string，避免临时字符串）
+void appendInt(std::pmr::string& text, std::size_t value)
+{
+    char buffer[24];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    text.append(buffer, end);
+}
+}
+
+LoadingScene::LoadingScene(engine::core::Context& context, engine::scene::SceneManager& scene_manager)
+    : Scene("LoadingScene", context, scene_manager)
+{
+}
+
+LoadingScene::~LoadingScene() = default;
+
+void LoadingScene::init()
+{
+    previous_budget_ms_ = scene_manager_.getStagingBudgetMs();
+    scene_manager_.setStagingBudgetMs(frame_budget_ms_);
+    if (!scene_manager_.isPreloadingScene()) {
+        spdlog::warn("LoadingScene: 没有后台准备中的场景。");
+    }
+    Scene::init();
+}
+
+void LoadingScene::clean()
+{
+    scene_manager_.setStagingBudgetMs(previous_budget_ms_);
+    Scene::clean();
+}
+
+void LoadingScene::render()
+{
+    Scene::render();
+    if (!scene_manager_.isPreloadingScene()) return;
+
+    // 预加载阶段显示资源数量，之后显示加载任务的进度
+    const auto* preloader = scene_manager_.getStagedPreloader();
+    float progress = 0.0f;
+    std::pmr::string text(&context_.getFrameArena());      // 每帧的文字只在本帧有效，从帧内存池分配
+    text.reserve(64);
+    if (scene_manager_.isStagedTaskRunning() || !preloader) {
+        progress = scene_manager_.getStagedTaskProgress();
+        text += "加载关卡... ";
+        appendInt(text, static_cast<std::size_t>(std::clamp(progress, 0.0f, 1.0f) * 100.0f));
+        text += '%';
+    } else {
+        progress = preloader->getProgress();
+        text += "加载中... ";
+        appendInt(text, preloader->getCompletedCount());
+        text += " / ";
+        appendInt(text, preloader->getTotalCount());
+    }
+
+    // 屏幕中央的进度条
+    const auto viewport = context_.getCamera().getViewportSize();
+    const glm::vec2 bar_size = {viewport.x * 0.6f, 12.0f};
+    const glm::vec2 bar_pos = (viewport - bar_size) / 2.0f;
+    auto& renderer = context_.getRenderer();
+    renderer.drawUIFilledRect({bar_pos, bar_size}, {0.2f, 0.2f, 0.2f, 1.0f});
+    renderer.drawUIFilledRect({bar_pos, {bar_size.x * progress, bar_size.y}}, {0.9f, 0.75f, 0.3f, 1.0f});
+
+    context_.getTextRenderer().drawUIText(text, LOADING_FONT, LOADING_FONT_SIZE, bar_pos + glm::vec2(0.0f, -24.0f));
+}
+
+} // namespace engine::scene
@@ -0,0 +1,34 @@
+#pragma once
+#include "scene.h"
+
+namespace engine::scene {
+
+/**
+ * @brief 加载场景：在 SceneManager 后台准备目标场景（requestPreloadScene）期间显示进度条。
+ *
+ * 加载工作（Preloader 接收解码结果、分帧加载任务）由 SceneManager 驱动，本场景只负责显示；
+ * 显示期间没有其他需要运行的场景，因此把每帧的准备预算提高到 frame_budget_ms_，离开时恢复。
+ * 准备完成后目标场景以替换方式切换进来，本场景随之销毁。
+ */
+class LoadingScene final : public Scene {
+private:
+    float frame_budget_ms_ = 8.0f;                              ///< @brief 显示期间每帧用于准备场景的时间预算
+    float previous_budget_ms_ = 0.0f;                           ///< @brief 进入前的预算（离开时恢复）
+
+public:
+    /**
+     * @brief 构造函数
+     * @param context 引擎上下文
+     * @param scene_manager 场景管理器（显示其后台准备中场景的进度）
+     */
+    LoadingScene(engine::core::Context& context, engine::scene::SceneManager& scene_manager);
+    ~LoadingScene() override;
+
+    void init() override;
+    void render() override;
+    void clean() override;
+
+    void setFrameBudgetMs(float budget_ms) { frame_budget_ms_ = budget_ms; }    ///< @brief 设置每帧时间预算（在 init 之前调用）
+};
+
+} // namespace engine::scene
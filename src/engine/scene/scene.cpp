@@ -4,8 +4,11 @@
 #include "../core/context.h"
 #include "../core/game_state.h"
 #include "../render/camera.h"
+#include "../render/text_renderer.h"
+#include "../resource/resource_scope.h"
 #include "../ui/ui_manager.h"
-#include <algorithm> // for std::remove_if
+#include <algorithm> // for std::find_if
+#include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
@@ -14,6 +17,7 @@ Scene::Scene(std::string_view name, engine::core::Context& context, engine::scen
     : scene_name_(name),
       context_(context), 
       scene_manager_(scene_manager), 
+      resource_scope_(std::make_unique<engine::resource::ResourceScope>(context.getResourceManager())),
       ui_manager_(std::make_unique<engine::ui::UIManager>()),
       is_initialized_(false) {
     spdlog::trace("场景 '{}' 构造完成。", scene_name_);
@@ -45,8 +49,11 @@ void Scene::update(float delta_time) {
     if (need_remove) {
         // 使用C++20新添加的erase_if删除需要移除的对象，比使用erase - remove_if更简洁
         // NOTE: 用此语句则没有机会调用clean方法，因此要在update中先调用clean方法
-        std::erase_if(game_objects_, [](const std::unique_ptr<engine::object::GameObject>& obj) {
-            return !obj || obj->isNeedRemove();
+        std::erase_if(game_objects_, [this](const std::unique_ptr<engine::object::GameObject>& obj) {
+            if (!obj) return true;
+            if (!obj->isNeedRemove()) return false;
+            unindexGameObject(obj.get());
+            return true;
         });
     }
 
@@ -67,6 +74,8 @@ void Scene::render() {
     for (const auto& obj : game_objects_) {
         if (obj) obj->render(context_);
     }
+    // 提交本帧的图集批量文字（伤害数字、血量标签等），位于UI之下
+    context_.getTextRenderer().flushBatchedText();
 
     // 渲染UI管理器
     ui_manager_->render(context_);
@@ -94,14 +103,19 @@ void Scene::clean() {
         if (obj) obj->clean();
     }
     game_objects_.clear();
+    name_index_.clear();
 
     is_initialized_ = false;        // 清理完成后，设置场景为未初始化
     spdlog::trace("场景 '{}' 清理完成。", scene_name_);
 }
 
 void Scene::addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
-    if (game_object) game_objects_.push_back(std::move(game_object));
-    else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+    if (game_object) {
+        indexGameObject(game_object.get());
+        game_objects_.push_back(std::move(game_object));
+    } else {
+        spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+    }
 }
 
 void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object)
@@ -116,16 +130,17 @@ void Scene::removeGameObject(engine::object::GameObject* game_object_ptr) {
         return;
     }
 
-    // erase-remove 移除法不可用，因为智能指针与裸指针无法比较
-    // 需要使用 std::remove_if 和 lambda 表达式自定义比较的方式
-    auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-                             [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
-                                 return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
-                             });
+    // 智能指针与裸指针无法直接比较，使用 std::find_if 和 lambda 表达式自定义比较方式。
+    // 先找到对象并在它仍然存活时取消索引、清理，再从容器中删除
+    auto it = std::find_if(game_objects_.begin(), game_objects_.end(),
+                           [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
+                               return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
+                           });
 
     if (it != game_objects_.end()) {
-        (*it)->clean();             // 因为传入的是指针，因此只可能有一个元素被移除，不需要遍历it到末尾
-        game_objects_.erase(it, game_objects_.end());   // 删除从it到末尾的元素（最后一个元素）
+        unindexGameObject(game_object_ptr);
+        game_object_ptr->clean();
+        game_objects_.erase(it);
         spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
     } else {
         spdlog::warn("游戏对象指针未找到在场景 '{}' 中。", scene_name_);
@@ -139,15 +154,39 @@ void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr)
 
 engine::object::GameObject *Scene::findGameObjectByName(std::string_view name) const
 {
-    // 找到第一个符合条件的游戏对象就返回
-    for (const auto& obj : game_objects_) {
-        if (obj && obj->getName() == name) {
-            return obj.get();
-        }
+    // 哈希冲突时同一个桶中可能有不同名称的对象，因此仍需比较名称
+    for (auto* obj : findGameObjectsByName(entt::hashed_string::value(name.data(), name.size()))) {
+        if (obj->getName() == name) return obj;
     }
     return nullptr;
 }
 
+engine::object::GameObject* Scene::findGameObjectByName(entt::id_type name_id) const {
+    auto objects = findGameObjectsByName(name_id);
+    return objects.empty() ? nullptr : objects.front();
+}
+
+std::span<engine::object::GameObject* const> Scene::findGameObjectsByName(entt::id_type name_id) const {
+    auto it = name_index_.find(name_id);
+    if (it == name_index_.end()) return {};
+    return it->second;
+}
+
+void Scene::indexGameObject(engine::object::GameObject* game_object) {
+    const auto name = game_object->getName();
+    if (name.empty()) return;       // 匿名对象不进入索引
+    name_index_[entt::hashed_string::value(name.data(), name.size())].push_back(game_object);
+}
+
+void Scene::unindexGameObject(engine::object::GameObject* game_object) {
+    const auto name = game_object->getName();
+    if (name.empty()) return;
+    auto it = name_index_.find(entt::hashed_string::value(name.data(), name.size()));
+    if (it == name_index_.end()) return;
+    std::erase(it->second, game_object);
+    if (it->second.empty()) name_index_.erase(it);
+}
+
 void Scene::processPendingAdditions()
 {
     // 处理待添加的游戏对象
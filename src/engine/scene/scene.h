@@ -1,8 +1,11 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <entt/core/fwd.hpp>
 
 namespace engine::core {
     class Context;
@@ -16,6 +19,10 @@ namespace engine::object {
     class GameObject;
 }
 
+namespace engine::resource {
+    class ResourceScope;
+}
+
 namespace engine::scene {
     class SceneManager;
 
@@ -30,11 +37,14 @@ protected:
     std::string scene_name_;                            ///< @brief 场景名称
     engine::core::Context& context_;                    ///< @brief 上下文引用（隐式，构造时传入）
     engine::scene::SceneManager& scene_manager_;        ///< @brief 场景管理器引用（构造时传入）
+    std::unique_ptr<engine::resource::ResourceScope> resource_scope_;   ///< @brief 场景资源作用域（最先声明，因此在对象/UI之后析构）
     std::unique_ptr<engine::ui::UIManager> ui_manager_; ///< @brief UI管理器(初始化时自动创建)
     
     bool is_initialized_ = false;                       ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
     std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象
     std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;    ///< @brief 待添加的游戏对象（延时添加）
+    /// @brief 名称索引：名称哈希(与 NameComponent::name_id_ 相同) -> 同名对象(按加入场景的顺序)，随对象的加入/移除同步维护
+    std::unordered_map<entt::id_type, std::vector<engine::object::GameObject*>> name_index_;
 
 public:
     /**
@@ -77,9 +87,18 @@ public:
     /// @brief 获取场景中的游戏对象容器。
     const std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() const { return game_objects_; }
 
-    /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+    /**
+     * @brief 根据名称查找游戏对象（返回最先加入场景的同名对象），通过名称索引查找。
+     * @note 名称应在对象加入场景之前设置，加入后再改名不会更新索引。
+     */
     engine::object::GameObject* findGameObjectByName(std::string_view name) const;
 
+    /// @brief 根据名称哈希(entt::hashed_string)查找游戏对象，返回最先加入场景的对象。
+    engine::object::GameObject* findGameObjectByName(entt::id_type name_id) const;
+
+    /// @brief 获取所有具有该名称哈希的游戏对象（按加入场景的顺序），例如所有出生点。
+    std::span<engine::object::GameObject* const> findGameObjectsByName(entt::id_type name_id) const;
+
     // getters and setters
     void setName(std::string_view name) { scene_name_ = name; }               ///< @brief 设置场景名称
     std::string_view getName() const { return scene_name_; }                  ///< @brief 获取场景名称
@@ -88,10 +107,15 @@ public:
 
     engine::core::Context& getContext() const { return context_; }                  ///< @brief 获取上下文引用
     engine::scene::SceneManager& getSceneManager() const { return scene_manager_; } ///< @brief 获取场景管理器引用
+    engine::resource::ResourceScope& getResourceScope() const { return *resource_scope_; }  ///< @brief 获取场景资源作用域（场景销毁时释放其中的引用）
     std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() { return game_objects_; } ///< @brief 获取场景中的游戏对象
 
 protected:
     void processPendingAdditions();     ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+
+private:
+    void indexGameObject(engine::object::GameObject* game_object);     ///< @brief 对象加入场景时登记到名称索引
+    void unindexGameObject(engine::object::GameObject* game_object);   ///< @brief 对象离开场景时从名称索引中移除
 };
 
 } // namespace engine::scene
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "scene_manager.h"
 #include "scene.h"
 #include "../core/context.h"
+#include "../debug/alloc_counter.h"
+#include "../resource/preloader.h"
+#include "../resource/resource_scope.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
@@ -23,6 +26,7 @@ Scene* SceneManager::getCurrentScene() const {
 }
 
 void SceneManager::update(float delta_time) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::ECS);
     // 只更新栈顶（当前）场景
     Scene* current_scene = getCurrentScene();
     if (current_scene) {
@@ -30,9 +34,12 @@ void SceneManager::update(float delta_time) {
     }
     // 执行可能的切换场景操作
     processPendingActions();
+    // 推进后台准备中的场景（准备完成的场景在下一帧切换）
+    updateStagedScene();
 }
 
 void SceneManager::render() {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::ECS);
     // 渲染时需要叠加渲染所有场景，而不只是栈顶
     for (const auto& scene : scene_stack_) {
         if (scene) {
@@ -42,6 +49,7 @@ void SceneManager::render() {
 }
 
 void SceneManager::handleInput() {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::ECS);
     // 只考虑栈顶场景
     Scene* current_scene = getCurrentScene();
     if (current_scene) {
@@ -51,6 +59,7 @@ void SceneManager::handleInput() {
 
 void SceneManager::close() {
     spdlog::trace("正在关闭场景管理器并清理场景栈...");
+    staged_scene_.reset();      // 先停止后台准备（等待解码线程结束）
     // 清理栈中所有剩余的场景（从顶到底）
     while (!scene_stack_.empty()) {
         if (scene_stack_.back()) {
@@ -78,6 +87,51 @@ void SceneManager::requestPushScene(std::unique_ptr<Scene>&& scene)
     pending_scene_ = std::move(scene);
 }
 
+void SceneManager::requestPreloadScene(std::unique_ptr<Scene>&& scene, std::unique_ptr<engine::resource::Preloader> preloader,
+                                       LoadTask load_task, bool replace, ProgressQuery load_progress)
+{
+    if (!scene) {
+        spdlog::warn("尝试在后台准备空场景。");
+        return;
+    }
+    if (staged_scene_) {
+        spdlog::warn("放弃后台准备中的场景 '{}' ，改为准备场景 '{}' 。", staged_scene_->scene_->getName(), scene->getName());
+        cancelPreloadScene();
+    }
+    spdlog::debug("开始在后台准备场景 '{}' 。", scene->getName());
+    staged_scene_ = std::make_unique<StagedScene>();
+    staged_scene_->scene_ = std::move(scene);
+    staged_scene_->preloader_ = std::move(preloader);
+    staged_scene_->load_task_ = std::move(load_task);
+    staged_scene_->load_progress_ = std::move(load_progress);
+    staged_scene_->action_ = replace ? PendingAction::Replace : PendingAction::Push;
+}
+
+void SceneManager::cancelPreloadScene()
+{
+    if (!staged_scene_) return;
+    spdlog::debug("取消后台准备场景 '{}' 。", staged_scene_->scene_->getName());
+    // 已经放入缓存的资源还没有被目标场景的资源作用域引用，不卸载就会一直留在缓存中
+    if (staged_scene_->preloader_) staged_scene_->preloader_->releaseLoaded();
+    staged_scene_.reset();
+}
+
+const engine::resource::Preloader* SceneManager::getStagedPreloader() const
+{
+    return staged_scene_ ? staged_scene_->preloader_.get() : nullptr;
+}
+
+bool SceneManager::isStagedTaskRunning() const
+{
+    if (!staged_scene_ || !staged_scene_->load_task_) return false;
+    return !staged_scene_->preloader_ || staged_scene_->preloader_->isDone();
+}
+
+float SceneManager::getStagedTaskProgress() const
+{
+    return staged_scene_ && staged_scene_->load_progress_ ? staged_scene_->load_progress_() : 0.0f;
+}
+
 // --- Private Methods ---
 
 void SceneManager::processPendingActions()
@@ -85,6 +139,7 @@ void SceneManager::processPendingActions()
     if (pending_action_ == PendingAction::None) {
         return;
     }
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::LOADER);    // 场景切换（初始化、加载关卡）记入加载
 
     switch (pending_action_) {
         case PendingAction::Pop:
@@ -103,6 +158,30 @@ void SceneManager::processPendingActions()
     pending_action_ = PendingAction::None;
 }
 
+void SceneManager::updateStagedScene()
+{
+    if (!staged_scene_) return;
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::LOADER);
+    auto& staged = *staged_scene_;
+
+    // 预加载与加载任务共用每帧的时间预算，未完成时下一帧继续
+    if (staged.preloader_ && !staged.preloader_->update(staging_budget_ms_)) return;
+    if (staged.load_task_) {
+        if (!staged.load_task_(staging_budget_ms_)) return;
+        staged.load_task_ = nullptr;
+    }
+    if (pending_action_ != PendingAction::None) return;     // 已有其他切换请求，等它处理完再切换
+
+    // 预加载的资源归目标场景所有，场景销毁时只释放它独占的资源
+    if (staged.preloader_) {
+        staged.scene_->getResourceScope().retain(staged.preloader_->getManifest());
+    }
+    spdlog::debug("场景 '{}' 已在后台准备完成，将在下一帧切换。", staged.scene_->getName());
+    pending_action_ = staged.action_;
+    pending_scene_ = std::move(staged.scene_);
+    staged_scene_.reset();
+}
+
 void SceneManager::pushScene(std::unique_ptr<Scene>&& scene) {
     if (!scene) {
         spdlog::warn("尝试将空场景压入栈。");
@@ -138,7 +217,8 @@ void SceneManager::replaceScene(std::unique_ptr<Scene>&& scene) {
         spdlog::warn("尝试用空场景替换。");
         return;
     }
-    spdlog::debug("正在用场景 '{}' 替换场景 '{}' 。", scene->getName(), scene_stack_.back()->getName());
+    spdlog::debug("正在用场景 '{}' 替换场景 '{}' 。", scene->getName(),
+                  scene_stack_.empty() ? std::string_view("(空)") : scene_stack_.back()->getName());
 
     // 清理并移除场景栈中所有场景
     while (!scene_stack_.empty()) {
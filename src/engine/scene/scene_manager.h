@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,21 +11,45 @@ namespace engine::core {
 namespace engine::scene {
     class Scene;
 }
+namespace engine::resource {
+    class Preloader;
+}
 
 namespace engine::scene {
 
 /**
  * @brief 管理游戏中的场景栈，处理场景切换和生命周期。
+ *
+ * 除了立即切换，还可以在后台准备下一个场景（requestPreloadScene）：资源在 Preloader 的工作线程中解码，
+ * 必须在主线程完成的步骤（创建纹理、增量加载关卡等）每帧只花费有限的时间，当前场景照常运行，
+ * 准备完成后在之后的某一帧切换，避免在切换的那一帧集中加载造成卡顿。
  */
 class SceneManager final {
+public:
+    using LoadTask = std::function<bool(float budget_ms)>;  ///< @brief 在时间预算内执行一部分工作，完成时返回 true
+    using ProgressQuery = std::function<float()>;           ///< @brief 查询加载任务的进度 (0~1)
+
 private:
+    enum class PendingAction { None, Push, Pop, Replace };  ///< @brief 待处理的动作
+
+    /// @brief 正在后台准备的场景
+    struct StagedScene {
+        std::unique_ptr<Scene> scene_;                                  ///< @brief 准备完成后切换到的场景（尚未初始化）
+        std::unique_ptr<engine::resource::Preloader> preloader_;        ///< @brief 场景资源的预加载器（可为空）
+        LoadTask load_task_;                                            ///< @brief 预加载之后执行的分帧加载任务（可为空）
+        ProgressQuery load_progress_;                                   ///< @brief 分帧加载任务的进度（可为空，用于加载界面）
+        PendingAction action_ = PendingAction::Replace;                 ///< @brief 准备完成后的切换方式（Push 或 Replace）
+    };
+
     engine::core::Context& context_;                        ///< @brief 引擎上下文引用
     std::vector<std::unique_ptr<Scene>> scene_stack_;       ///< @brief 场景栈
 
-    enum class PendingAction { None, Push, Pop, Replace };  ///< @brief 待处理的动作
     PendingAction pending_action_ = PendingAction::None;    ///< @brief 待处理的动作
     std::unique_ptr<Scene> pending_scene_;                  ///< @brief 待处理场景
 
+    std::unique_ptr<StagedScene> staged_scene_;             ///< @brief 后台准备中的场景（没有时为空）
+    float staging_budget_ms_ = 2.0f;                        ///< @brief 每帧用于准备场景的主线程时间预算
+
 public:
     explicit SceneManager(engine::core::Context& context);
     ~SceneManager();
@@ -40,6 +65,27 @@ public:
     void requestPopScene();                                     ///< @brief 请求弹出当前场景。
     void requestReplaceScene(std::unique_ptr<Scene>&& scene);   ///< @brief 请求替换当前场景。
 
+    /**
+     * @brief 请求在后台准备一个场景，准备完成后在之后的某一帧压入或替换当前场景。
+     *
+     * 准备期间当前场景照常更新与渲染。场景的 init() 在切换时才调用（它通常会连接输入回调），
+     * 因此耗时的工作应放在预加载清单或分帧加载任务中。再次调用会放弃之前未完成的准备。
+     * @param scene 目标场景
+     * @param preloader 已开始工作的预加载器（可为空），完成后清单中的资源由目标场景的资源作用域引用
+     * @param load_task 预加载之后执行的分帧加载任务（可为空），例如向目标场景增量加载关卡
+     * @param replace true 表示替换整个场景栈，false 表示压入栈顶
+     * @param load_progress 分帧加载任务的进度查询（可为空），供加载界面显示
+     */
+    void requestPreloadScene(std::unique_ptr<Scene>&& scene, std::unique_ptr<engine::resource::Preloader> preloader,
+                             LoadTask load_task = {}, bool replace = true, ProgressQuery load_progress = {});
+    void cancelPreloadScene();                                  ///< @brief 放弃后台准备中的场景，并卸载预加载器已放入缓存的资源。
+    bool isPreloadingScene() const { return staged_scene_ != nullptr; }                 ///< @brief 是否有场景正在后台准备
+    void setStagingBudgetMs(float budget_ms) { staging_budget_ms_ = budget_ms; }        ///< @brief 设置每帧准备场景的时间预算
+    float getStagingBudgetMs() const { return staging_budget_ms_; }                     ///< @brief 获取每帧准备场景的时间预算
+    const engine::resource::Preloader* getStagedPreloader() const;  ///< @brief 后台准备中场景的预加载器（没有时为空）
+    bool isStagedTaskRunning() const;                               ///< @brief 后台准备是否已进入分帧加载任务阶段
+    float getStagedTaskProgress() const;                            ///< @brief 分帧加载任务的进度 (0~1，没有进度查询时为 0)
+
     // getters
     Scene* getCurrentScene() const;                                 ///< @brief 获取当前活动场景（栈顶场景）的指针。
     engine::core::Context& getContext() const { return context_; }  ///< @brief 获取引擎上下文引用。
@@ -52,6 +98,7 @@ public:
 
 private:
     void processPendingActions();                           ///< @brief 处理挂起的场景操作（每轮更新最后调用）。
+    void updateStagedScene();                               ///< @brief 推进后台准备中的场景，完成后转为待处理的切换。
     // 直接切换场景
     void pushScene(std::unique_ptr<Scene>&& scene);         ///< @brief 将一个新场景压入栈顶，使其成为活动场景。
     void popScene();                                        ///< @brief 移除栈顶场景。
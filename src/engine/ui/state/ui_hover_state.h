@@ -16,7 +16,7 @@ public:
 
 private:
     void enter() override;
-    std::unique_ptr<UIState> handleInput(engine::core::Context& context) override;
+    std::unique_ptr<UIState> handleInput(engine::core::Context& context, UIPointerEvent event) override;
 };
 
 } // namespace engine::ui::state
\ No newline at end of file
@@ -14,9 +14,11 @@ public:
     UINormalState(engine::ui::UIInteractive* owner) : UIState(owner) {}
     ~UINormalState() override = default;
 
+    bool isIdle() const override { return true; }
+
 private:
     void enter() override;
-    std::unique_ptr<UIState> handleInput(engine::core::Context& context) override;
+    std::unique_ptr<UIState> handleInput(engine::core::Context& context, UIPointerEvent event) override;
 };
 
 } // namespace engine::ui::state
\ No newline at end of file
@@ -2,8 +2,6 @@
 #include "ui_normal_state.h"
 #include "ui_hover_state.h"
 #include "../ui_interactive.h"
-#include "../../input/input_manager.h"
-#include "../../core/context.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui::state {
@@ -15,12 +13,10 @@ void UIPressedState::enter()
     spdlog::debug("切换到按下状态");
 }
 
-std::unique_ptr<UIState> UIPressedState::handleInput(engine::core::Context& context)
+std::unique_ptr<UIState> UIPressedState::handleInput(engine::core::Context&, UIPointerEvent event)
 {
-    auto& input_manager = context.getInputManager();
-    auto mouse_pos = input_manager.getLogicalMousePosition();
-    if (input_manager.isActionReleased("MouseLeftClick")) {
-        if (!owner_->isPointInside(mouse_pos)) {        // 松开鼠标时，如果不在UI元素内，则切换到正常状态
+    if (event == UIPointerEvent::RELEASED) {
+        if (!owner_->isPointerOver()) {                 // 松开鼠标时，如果不在UI元素上，则切换到正常状态
             return std::make_unique<engine::ui::state::UINormalState>(owner_);
         } else {                                        // 松开鼠标时，如果还在UI元素内，则触发点击事件
             owner_->clicked();
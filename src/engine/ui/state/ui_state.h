@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <memory>
 
 namespace engine::core {
@@ -11,6 +12,13 @@ namespace engine::ui {
 
 namespace engine::ui::state {
 
+/// @brief 交给状态处理的一次指针输入：左键的一次按下/释放，或没有按键跳变时的一次指针位置更新
+enum class UIPointerEvent : std::uint8_t {
+    NONE,       ///< @brief 只有指针位置（悬停判断）
+    PRESSED,    ///< @brief 左键按下
+    RELEASED    ///< @brief 左键释放
+};
+
 /**
  * @brief 可交互UI元素在特定状态下的行为接口。
  *
@@ -35,10 +43,16 @@ public:
     UIState(UIState&&) = delete;
     UIState& operator=(UIState&&) = delete;
 
+    virtual bool isIdle() const { return false; }   ///< @brief 是否为空闲状态(空闲的元素只有被指针命中时才需要处理输入)
+
 protected:
     // --- 核心方法 --- 
     virtual void enter() {}
-    virtual std::unique_ptr<UIState> handleInput(engine::core::Context& context) = 0;
+    /**
+     * @brief 处理一次指针输入，返回要切换到的状态（不切换返回 nullptr）
+     * @param event 本次处理的按键跳变。同一帧内的多次跳变按顺序逐个交给状态，不会被合并
+     */
+    virtual std::unique_ptr<UIState> handleInput(engine::core::Context& context, UIPointerEvent event) = 0;
 };
 
 } // namespace engine::ui::state
\ No newline at end of file
@@ -0,0 +1,293 @@
+#include "ui_config.h"
+#include "ui_element.h"
+#include "ui_panel.h"
+#include "ui_image.h"
+#include "ui_label.h"
+#include "../core/context.h"
+#include "../resource/resource_manager.h"
+#include "../debug/alloc_counter.h"
+#include <algorithm>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+namespace engine::ui {
+
+namespace {
+
+constexpr std::string_view LAYOUT_GROUP = "layout";
+
+/// @brief 读取 {"x":..,"y":..} 或 {"width":..,"height":..} 形式的二维向量
+glm::vec2 readVec2(const nlohmann::json& json, std::string_view key, std::string_view x_key, std::string_view y_key,
+                   glm::vec2 default_value = {0.0f, 0.0f}) {
+    auto it = json.find(key);
+    if (it == json.end() || !it->is_object()) return default_value;
+    return {it->value(x_key, default_value.x), it->value(y_key, default_value.y)};
+}
+
+} // namespace
+
+UIConfig::UIConfig(engine::resource::ResourceManager& resource_manager)
+    : resource_manager_(resource_manager) {
+}
+
+bool UIConfig::load(std::string_view file_path) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
+    auto text = resource_manager_.readTextFile(file_path);
+    if (!text) {
+        spdlog::error("UIConfig: 无法打开文件 '{}'。", file_path);
+        return false;
+    }
+    nlohmann::json json;
+    try {
+        json = nlohmann::json::parse(*text);
+    } catch (const std::exception& e) {
+        spdlog::error("UIConfig: 解析 '{}' 失败: {}", file_path, e.what());
+        return false;
+    }
+    if (!json.is_object()) {
+        spdlog::error("UIConfig: '{}' 的根节点不是对象。", file_path);
+        return false;
+    }
+
+    clear();
+    // 先编译区域，布局中的节点按名称引用它们
+    for (const auto& [group, group_json] : json.items()) {
+        if (group != LAYOUT_GROUP && group_json.is_object()) compileRegions(group, group_json);
+    }
+    if (auto it = json.find(LAYOUT_GROUP); it != json.end() && it->is_object()) {
+        for (const auto& [name, layout_json] : it->items()) {
+            auto nodes_it = layout_json.find("nodes");
+            if (nodes_it == layout_json.end()) continue;    // 不含节点的条目(例如 unit_panel 参数)由游戏代码自行读取
+            if (!compileLayout(name, *nodes_it)) {
+                spdlog::error("UIConfig: 布局 '{}' 编译失败，已跳过。", name);
+            }
+        }
+    }
+    rects_.resize(nodes_.size());
+    layout_size_ = {-1.0f, -1.0f};      // 下次 relayout 必然重新计算
+
+    spdlog::info("UIConfig: 已加载 '{}'：区域 {}，布局 {}，节点 {}。", file_path, regions_.size(), layouts_.size(), nodes_.size());
+    return true;
+}
+
+bool UIConfig::relayout(const glm::vec2& parent_size) {
+    if (parent_size == layout_size_) return false;
+    layout_size_ = parent_size;
+
+    // 节点按先序排列，计算子节点时父节点的大小已经确定
+    for (const auto& layout : layouts_) {
+        for (int i = layout.first_node_; i < layout.first_node_ + layout.node_count_; ++i) {
+            const auto& node = nodes_[i];
+            glm::vec2 size = node.size_;
+            if (node.type_ == UINodeType::IMAGE && size.x == 0.0f && size.y == 0.0f && node.region_ >= 0) {
+                const auto& src = regions_[node.region_].source_rect_;
+                size = {src.w, src.h};
+            }
+            const glm::vec2 available = node.parent_ >= 0 ? rects_[layout.first_node_ + node.parent_].size : parent_size;
+            rects_[i].position = node.anchor_ * (available - size) + node.offset_;
+            rects_[i].size = size;
+        }
+    }
+    return true;
+}
+
+UIElement* UIConfig::instantiate(std::string_view layout_name, UIElement& parent, engine::core::Context& context,
+                                 std::vector<UIElement*>* views) const {
+    const auto* layout = findLayout(layout_name);
+    if (!layout) {
+        spdlog::error("UIConfig: 布局 '{}' 不存在。", layout_name);
+        return nullptr;
+    }
+    if (layout_size_.x < 0.0f) {
+        spdlog::warn("UIConfig: 实例化布局 '{}' 前没有调用 relayout，所有节点位于原点。", layout_name);
+    }
+
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
+    std::vector<UIElement*> local_views;
+    auto& created = views ? *views : local_views;
+    created.assign(layout->node_count_, nullptr);
+
+    UIElement* first = nullptr;
+    for (int i = 0; i < layout->node_count_; ++i) {
+        const auto& node = nodes_[layout->first_node_ + i];
+        const auto& rect = rects_[layout->first_node_ + i];
+
+        std::unique_ptr<UIElement> element;
+        switch (node.type_) {
+            case UINodeType::PANEL:
+                element = std::make_unique<UIPanel>(rect.position, rect.size,
+                                                    node.has_color_ ? std::optional(node.color_) : std::nullopt);
+                break;
+            case UINodeType::IMAGE: {
+                const auto& region = regions_[node.region_];
+                element = std::make_unique<UIImage>(region.texture_.getPath(), rect.position, rect.size, region.source_rect_);
+                break;
+            }
+            case UINodeType::LABEL:
+                element = std::make_unique<UILabel>(context.getTextRenderer(), strings_[node.text_], strings_[node.font_],
+                                                    node.font_size_, node.color_, rect.position);
+                break;
+        }
+
+        created[i] = element.get();
+        UIElement& owner = node.parent_ >= 0 ? *created[node.parent_] : parent;
+        owner.addChild(std::move(element));
+        if (!first && node.parent_ < 0) first = created[i];
+    }
+    return first;
+}
+
+void UIConfig::applyLayout(std::string_view layout_name, std::span<UIElement* const> views) const {
+    const auto* layout = findLayout(layout_name);
+    if (!layout || static_cast<int>(views.size()) != layout->node_count_) {
+        spdlog::error("UIConfig: applyLayout 的布局 '{}' 不存在或元素数量不匹配。", layout_name);
+        return;
+    }
+    for (int i = 0; i < layout->node_count_; ++i) {
+        if (!views[i]) continue;
+        const auto& rect = rects_[layout->first_node_ + i];
+        views[i]->setPosition(rect.position);
+        if (nodes_[layout->first_node_ + i].type_ != UINodeType::LABEL) {   // 文字的大小由排版决定
+            views[i]->setSize(rect.size);
+        }
+    }
+}
+
+const UIRegion* UIConfig::getRegion(std::string_view key) const {
+    auto it = region_index_.find(key);
+    return it != region_index_.end() ? &regions_[it->second] : nullptr;
+}
+
+int UIConfig::findNode(std::string_view layout_name, std::string_view node_name) const {
+    const auto* layout = findLayout(layout_name);
+    if (!layout) return -1;
+    for (int i = 0; i < layout->node_count_; ++i) {
+        const int name = nodes_[layout->first_node_ + i].name_;
+        if (name >= 0 && strings_[name] == node_name) return i;
+    }
+    return -1;
+}
+
+bool UIConfig::applyRegion(UIImage& image, std::string_view region_key) const {
+    const auto* region = getRegion(region_key);
+    if (!region) {
+        spdlog::warn("UIConfig: 区域 '{}' 不存在。", region_key);
+        return false;
+    }
+    image.setTextureId(region->texture_.getPath());
+    image.setSourceRect(region->source_rect_);
+    return true;
+}
+
+void UIConfig::clear() {
+    regions_.clear();
+    nodes_.clear();
+    rects_.clear();
+    strings_.clear();
+    layouts_.clear();
+    region_index_.clear();
+    layout_index_.clear();
+}
+
+void UIConfig::compileRegions(std::string_view group, const nlohmann::json& group_json) {
+    for (const auto& [name, region_json] : group_json.items()) {
+        if (!region_json.is_object() || !region_json.contains("sprite_sheet")) continue;
+
+        UIRegion region;
+        region.texture_ = engine::resource::TextureHandle(resource_manager_, region_json["sprite_sheet"].get<std::string>());
+        region.source_rect_ = {region_json.value("x", 0.0f), region_json.value("y", 0.0f),
+                               region_json.value("width", 0.0f), region_json.value("height", 0.0f)};
+
+        // 预先载入纹理并校验源矩形，实例化与绘制时不会再遇到缺失的纹理
+        if (!region.texture_.get()) {
+            spdlog::error("UIConfig: 区域 '{}/{}' 的纹理 '{}' 载入失败，已跳过。", group, name, region.texture_.getPath());
+            continue;
+        }
+        const auto texture_size = resource_manager_.getTextureSize(region.texture_.getPath());
+        const auto& src = region.source_rect_;
+        if (src.w <= 0.0f || src.h <= 0.0f || src.x + src.w > texture_size.x || src.y + src.h > texture_size.y) {
+            spdlog::warn("UIConfig: 区域 '{}/{}' 的源矩形超出纹理范围。", group, name);
+        }
+
+        region_index_[std::string(group) + "/" + name] = static_cast<int>(regions_.size());
+        regions_.push_back(std::move(region));
+    }
+}
+
+bool UIConfig::compileLayout(std::string_view name, const nlohmann::json& nodes_json) {
+    if (!nodes_json.is_array()) return false;
+
+    const int first_node = static_cast<int>(nodes_.size());
+    std::unordered_map<std::string, int, engine::utils::StringHash, std::equal_to<>> node_names;    // 名称 -> 布局内下标
+
+    for (const auto& node_json : nodes_json) {
+        UINode node;
+        const auto type = node_json.value("type", "panel");
+        if (type == "image") node.type_ = UINodeType::IMAGE;
+        else if (type == "label") node.type_ = UINodeType::LABEL;
+        else if (type != "panel") {
+            spdlog::error("UIConfig: 布局 '{}' 中的节点类型 '{}' 未知。", name, type);
+            nodes_.resize(first_node);
+            return false;
+        }
+
+        // 父节点必须出现在前面（保证先序，布局计算可以一次顺序完成）
+        if (auto it = node_json.find("parent"); it != node_json.end() && it->is_string()) {
+            auto parent_it = node_names.find(it->get<std::string>());
+            if (parent_it == node_names.end()) {
+                spdlog::error("UIConfig: 布局 '{}' 中的父节点 '{}' 不存在或位于子节点之后。", name, it->get<std::string>());
+                nodes_.resize(first_node);
+                return false;
+            }
+            node.parent_ = parent_it->second;
+        }
+
+        if (node.type_ == UINodeType::IMAGE) {
+            auto region_it = region_index_.find(node_json.value("region", ""));
+            if (region_it == region_index_.end()) {
+                spdlog::error("UIConfig: 布局 '{}' 引用的区域 '{}' 不存在。", name, node_json.value("region", ""));
+                nodes_.resize(first_node);
+                return false;
+            }
+            node.region_ = region_it->second;
+        } else if (node.type_ == UINodeType::LABEL) {
+            node.text_ = internString(node_json.value("text", ""));
+            node.font_ = internString(node_json.value("font_path", ""));
+            node.font_size_ = node_json.value("font_size", node.font_size_);
+        }
+
+        node.anchor_ = readVec2(node_json, "anchor", "x", "y");
+        node.offset_ = readVec2(node_json, "offset", "x", "y");
+        node.size_ = readVec2(node_json, "size", "width", "height");
+        if (auto it = node_json.find("color"); it != node_json.end() && it->is_array() && it->size() == 4) {
+            node.color_ = {(*it)[0].get<float>(), (*it)[1].get<float>(), (*it)[2].get<float>(), (*it)[3].get<float>()};
+            node.has_color_ = true;
+        }
+
+        if (auto it = node_json.find("name"); it != node_json.end() && it->is_string()) {
+            node_names[it->get<std::string>()] = static_cast<int>(nodes_.size()) - first_node;
+            node.name_ = internString(it->get<std::string>());
+        }
+        nodes_.push_back(node);
+    }
+
+    layout_index_[std::string(name)] = static_cast<int>(layouts_.size());
+    layouts_.push_back({first_node, static_cast<int>(nodes_.size()) - first_node});
+    return true;
+}
+
+int UIConfig::internString(std::string_view text) {
+    if (auto it = std::find(strings_.begin(), strings_.end(), text); it != strings_.end()) {
+        return static_cast<int>(it - strings_.begin());
+    }
+    strings_.emplace_back(text);
+    return static_cast<int>(strings_.size()) - 1;
+}
+
+const UIConfig::Layout* UIConfig::findLayout(std::string_view layout_name) const {
+    auto it = layout_index_.find(layout_name);
+    return it != layout_index_.end() ? &layouts_[it->second] : nullptr;
+}
+
+} // namespace engine::ui
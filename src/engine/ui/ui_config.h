@@ -0,0 +1,154 @@
+#pragma once
+#include <SDL3/SDL_rect.h>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <nlohmann/json_fwd.hpp>
+#include "../utils/math.h"
+#include "../utils/string_hash.h"
+#include "../resource/resource_handle.h"
+
+namespace engine::core {
+    class Context;
+}
+
+namespace engine::ui {
+class UIElement;
+class UIImage;
+
+/// @brief 图集中的一个区域（纹理 + 源矩形），加载时已确认纹理可用
+struct UIRegion {
+    engine::resource::TextureHandle texture_;   ///< @brief 纹理句柄（sprite_sheet），持有期间纹理不会被淘汰
+    SDL_FRect source_rect_ = {0, 0, 0, 0};      ///< @brief 源矩形
+};
+
+/// @brief 布局节点类型
+enum class UINodeType : std::uint8_t {
+    PANEL,      ///< @brief UIPanel（可选背景色）
+    IMAGE,      ///< @brief UIImage（引用一个区域）
+    LABEL       ///< @brief UILabel
+};
+
+/**
+ * @brief 布局中的一个节点（编译后的平坦数据，按先序排列，父节点总在子节点之前）
+ *
+ * 字符串不放在节点中，而是以下标引用 UIConfig 的字符串表，节点本身可以直接拷贝。
+ */
+struct UINode {
+    UINodeType type_ = UINodeType::PANEL;
+    int parent_ = -1;                           ///< @brief 父节点在布局内的下标（-1 表示挂到实例化时给出的父元素）
+    int name_ = -1;                             ///< @brief 节点名称在字符串表中的下标（未命名为 -1）
+    int region_ = -1;                           ///< @brief 区域下标（IMAGE）
+    int text_ = -1;                             ///< @brief 文本在字符串表中的下标（LABEL）
+    int font_ = -1;                             ///< @brief 字体路径在字符串表中的下标（LABEL）
+    int font_size_ = 16;                        ///< @brief 字体大小（LABEL）
+    glm::vec2 anchor_ = {0.0f, 0.0f};           ///< @brief 锚点（0~1），节点的同一相对点与父节点对齐
+    glm::vec2 offset_ = {0.0f, 0.0f};           ///< @brief 对齐后的偏移
+    glm::vec2 size_ = {0.0f, 0.0f};             ///< @brief 大小（IMAGE 为 0 时使用区域大小）
+    engine::utils::FColor color_ = {1.0f, 1.0f, 1.0f, 1.0f};   ///< @brief 文字颜色（LABEL）或背景色（PANEL）
+    bool has_color_ = false;                    ///< @brief 是否指定了颜色（PANEL 没有颜色时不绘制背景）
+};
+
+/**
+ * @brief 从 ui_config.json 编译而来的UI描述。
+ *
+ * - 除 "layout" 外的每个分组（icon、portrait_frame、portrait...）中的条目都是一个图集区域，
+ *   以 "分组/名称" 为键编译进区域表，纹理在加载时通过句柄载入并校验，之后一直保持可用；
+ * - "layout" 中带有 "nodes" 数组的条目是一个布局，所有布局的节点编译进同一个平坦数组，
+ *   父子关系以下标表示。布局计算只在父元素大小变化时进行（relayout），
+ *   实例化时直接使用计算好的矩形创建 UIPanel/UIImage/UILabel。
+ */
+class UIConfig final {
+private:
+    /// @brief 一个布局在节点数组中的范围
+    struct Layout {
+        int first_node_ = 0;
+        int node_count_ = 0;
+    };
+
+    engine::resource::ResourceManager& resource_manager_;
+
+    std::vector<UIRegion> regions_;                                                 ///< @brief 区域表
+    std::vector<UINode> nodes_;                                                     ///< @brief 所有布局的节点
+    std::vector<engine::utils::Rect> rects_;                                        ///< @brief 布局结果：节点相对父节点的位置与大小
+    std::vector<std::string> strings_;                                              ///< @brief 文本与字体路径
+    std::vector<Layout> layouts_;                                                   ///< @brief 布局表
+    std::unordered_map<std::string, int, engine::utils::StringHash, std::equal_to<>> region_index_;  ///< @brief "分组/名称" -> 区域下标
+    std::unordered_map<std::string, int, engine::utils::StringHash, std::equal_to<>> layout_index_;  ///< @brief 布局名称 -> 布局下标
+    glm::vec2 layout_size_ = {-1.0f, -1.0f};                                        ///< @brief 上次布局计算使用的父元素大小
+
+public:
+    /**
+     * @brief 构造函数
+     * @param resource_manager 用于读取配置文件与预先载入纹理
+     */
+    explicit UIConfig(engine::resource::ResourceManager& resource_manager);
+
+    /**
+     * @brief 加载并编译配置文件（会替换已加载的内容）
+     * @param file_path 配置文件路径（优先从资源包读取）
+     * @return 是否成功
+     */
+    [[nodiscard]] bool load(std::string_view file_path);
+
+    /**
+     * @brief 按新的父元素大小重新计算所有布局，大小未变化时直接返回
+     * @return 布局是否被重新计算
+     */
+    bool relayout(const glm::vec2& parent_size);
+
+    /**
+     * @brief 实例化一个布局：按节点顺序创建UI元素并挂到 parent 下
+     * @param layout_name 布局名称
+     * @param parent 父元素
+     * @param context 引擎上下文（UILabel 需要文本渲染器）
+     * @param views 可选：输出每个节点对应的元素（与节点一一对应），用于 applyLayout
+     * @return 第一个顶层节点对应的元素，布局不存在时返回 nullptr
+     */
+    UIElement* instantiate(std::string_view layout_name, UIElement& parent, engine::core::Context& context,
+                           std::vector<UIElement*>* views = nullptr) const;
+
+    /**
+     * @brief 把 relayout 的结果写回已实例化的元素（只修改位置与大小）
+     * @param layout_name 布局名称
+     * @param views instantiate 输出的元素列表
+     */
+    void applyLayout(std::string_view layout_name, std::span<UIElement* const> views) const;
+
+    const UIRegion* getRegion(std::string_view key) const;          ///< @brief 按 "分组/名称" 获取区域，不存在返回 nullptr
+
+    /**
+     * @brief 查找布局中的命名节点，用于在实例化后按名称找到对应元素（views[下标]）填入实际数据
+     * @return 节点在布局内的下标，不存在返回 -1
+     */
+    int findNode(std::string_view layout_name, std::string_view node_name) const;
+
+    /**
+     * @brief 把区域的纹理与源矩形设置到 UIImage 上（例如按实际单位替换头像）
+     * @return 区域是否存在
+     */
+    bool applyRegion(UIImage& image, std::string_view region_key) const;
+    bool hasLayout(std::string_view layout_name) const { return layout_index_.find(layout_name) != layout_index_.end(); }
+    std::size_t getRegionCount() const { return regions_.size(); }  ///< @brief 区域数量
+    std::size_t getNodeCount() const { return nodes_.size(); }      ///< @brief 所有布局的节点总数
+
+    // 禁用拷贝和移动语义
+    UIConfig(const UIConfig&) = delete;
+    UIConfig& operator=(const UIConfig&) = delete;
+    UIConfig(UIConfig&&) = delete;
+    UIConfig& operator=(UIConfig&&) = delete;
+
+private:
+    void clear();                                                           ///< @brief 清空所有编译结果
+    void compileRegions(std::string_view group, const nlohmann::json& group_json);  ///< @brief 编译一个区域分组
+    bool compileLayout(std::string_view name, const nlohmann::json& nodes_json);    ///< @brief 编译一个布局的节点
+    int internString(std::string_view text);                                ///< @brief 把字符串加入字符串表，返回下标
+    const Layout* findLayout(std::string_view layout_name) const;           ///< @brief 按名称查找布局
+};
+
+} // namespace engine::ui
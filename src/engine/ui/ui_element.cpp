@@ -10,20 +10,8 @@ UIElement::UIElement(glm::vec2 position, glm::vec2 size)
     : position_(std::move(position)), size_(std::move(size)) {
 }   
 
-bool UIElement::handleInput(engine::core::Context& context) {
-    // 如果元素不可见，直接返回 false
-    if (!visible_) return false; 
-
-    // 遍历所有子节点，并删除标记了移除的元素
-    for (auto it = children_.begin(); it != children_.end();) {
-        if (*it && !(*it)->isNeedRemove()) {
-            if ((*it)->handleInput(context)) return true;
-            ++it;
-        } else {
-            it = children_.erase(it);
-        }
-    }
-    // 事件未被消耗，返回假
+bool UIElement::handleInput(engine::core::Context&) {
+    // 普通元素不响应指针输入；可交互元素由 UIManager 直接分发，无需遍历子节点
     return false;
 }
 
@@ -37,16 +25,17 @@ void UIElement::update(float delta_time, engine::core::Context& context) {
             ++it;
         } else {
             it = children_.erase(it);
+            markLayoutDirty();
         }
     }
 }
 
-void UIElement::render(engine::core::Context& context) {
+void UIElement::render(engine::render::UIDrawList& draw_list, engine::core::Context& context) {
     if (!visible_) return;
 
-    // 渲染子元素
+    // 录制子元素
     for (const auto& child : children_) {
-        if (child) child->render(context);
+        if (child) child->render(draw_list, context);
     }
 }
 
@@ -67,7 +56,7 @@ std::unique_ptr<UIElement> UIElement::removeChild(UIElement* child_ptr) {
     if (it != children_.end()) {
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
-        removed_child->setParent(nullptr);      // 清除父指针
+        removed_child->setParent(nullptr);      // 清除父指针(同时标记本树布局变化)
         return removed_child;                   // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -78,18 +67,70 @@ void UIElement::removeAllChildren() {
         child->setParent(nullptr); // 清除父指针
     }
     children_.clear();
+    markLayoutDirty();
+}
+
+void UIElement::setParent(UIElement* parent) {
+    if (parent_ == parent) return;
+    if (parent_) parent_->markLayoutDirty();    // 离开旧的树
+    parent_ = parent;
+    invalidateScreenPosition();
+    markLayoutDirty();                          // 加入新的树
+}
+
+void UIElement::setPosition(glm::vec2 position) {
+    if (position_ == position) return;
+    position_ = std::move(position);
+    invalidateScreenPosition();
+    markLayoutDirty();
+}
+
+void UIElement::setSize(glm::vec2 size) {
+    if (size_ == size) return;
+    size_ = std::move(size);
+    markLayoutDirty();
+}
+
+void UIElement::setVisible(bool visible) {
+    if (visible_ == visible) return;
+    visible_ = visible;
+    markLayoutDirty();
+}
+
+void UIElement::markRenderDirty() {
+    UIElement* root = this;
+    while (root->parent_) root = root->parent_;
+    root->render_dirty_ = true;
+}
+
+void UIElement::markLayoutDirty() {
+    UIElement* root = this;
+    while (root->parent_) root = root->parent_;
+    root->layout_dirty_ = true;
+    root->render_dirty_ = true;
+}
+
+void UIElement::invalidateScreenPosition() {
+    // 已失效的节点其子孙必然也已失效(重新计算总是先计算祖先)，无需继续向下传递
+    if (screen_position_dirty_) return;
+    screen_position_dirty_ = true;
+    for (const auto& child : children_) {
+        if (child) child->invalidateScreenPosition();
+    }
 }
 
 glm::vec2 UIElement::getScreenPosition() const {
-    if (parent_) {
-        return parent_->getScreenPosition() + position_;
+    if (screen_position_dirty_) {
+        // 根元素的位置已经是相对屏幕的绝对位置
+        screen_position_ = parent_ ? parent_->getScreenPosition() + position_ : position_;
+        screen_position_dirty_ = false;
     }
-    return position_; // 根元素的位置已经是相对屏幕的绝对位置
+    return screen_position_;
 }
 
 engine::utils::Rect UIElement::getBounds() const {
-    auto abs_pos = getScreenPosition();
-    return engine::utils::Rect(abs_pos, size_);
+    // 大小直接读取成员(派生类会直接修改 size_)，只有位置需要缓存
+    return engine::utils::Rect(getScreenPosition(), size_);
 }
 
 bool UIElement::isPointInside(const glm::vec2& point) const {
@@ -7,6 +7,9 @@
 namespace engine::core {
     class Context;
 }
+namespace engine::render {
+    class UIDrawList;
+}
 
 namespace engine::ui {
 
@@ -16,10 +19,14 @@ namespace engine::ui {
  * 定义了位置、大小、可见性、状态等通用属性。
  * 管理子元素的层次结构。
  * 提供事件处理、更新和渲染的虚方法。
+ * 渲染是录制式的：render() 把自身写入 UIDrawList，只在树被标记为需要重绘后才会调用；
+ * 因此派生类修改任何影响外观的属性后都要调用 markRenderDirty()。
+ * 指针输入不再逐层递归：UIManager 按命中测试把输入直接交给最上层的可交互元素，
+ * 影响命中区域的修改(位置、大小、可见性、层级)通过 markLayoutDirty() 触发命中索引的重建。
  */
 class UIElement {
 protected:
-    glm::vec2 position_;                                    ///< @brief 相对于父元素的局部位置
+    glm::vec2 position_;                                    ///< @brief 相对于父元素的局部位置(修改请使用setPosition，以便使缓存失效)
     glm::vec2 size_;                                        ///< @brief 元素大小
     bool visible_ = true;                                   ///< @brief 元素当前是否可见
     bool need_remove_ = false;                              ///< @brief 是否需要移除(延迟删除)
@@ -27,6 +34,11 @@ protected:
     UIElement* parent_ = nullptr;                           ///< @brief 指向父节点的非拥有指针
     std::vector<std::unique_ptr<UIElement>> children_;      ///< @brief 子元素列表(容器)
 
+    mutable glm::vec2 screen_position_ = {0.0f, 0.0f};      ///< @brief 缓存的屏幕位置
+    mutable bool screen_position_dirty_ = true;             ///< @brief 缓存是否失效(位置或父节点变化时置位，并传递给所有子孙)
+    bool render_dirty_ = true;                              ///< @brief 绘制列表是否需要重新录制(只在根节点上置位)
+    bool layout_dirty_ = true;                              ///< @brief 命中索引是否需要重建(只在根节点上置位)
+
 public:
     /**
      * @brief 构造UIElement
@@ -41,9 +53,9 @@ public:
     virtual ~UIElement() = default;
 
     // --- 核心虚循环方法 --- (没有使用init和clean，注意构造函数和析构函数的使用)
-    virtual bool handleInput(engine::core::Context& context);
+    virtual bool handleInput(engine::core::Context& context);   ///< @brief 处理输入(由 UIManager 根据命中测试调用，不递归子元素)
     virtual void update(float delta_time, engine::core::Context& context);
-    virtual void render(engine::core::Context& context);
+    virtual void render(engine::render::UIDrawList& draw_list, engine::core::Context& context);   ///< @brief 将自身及子元素录制到绘制列表
 
     // --- 层次结构管理 ---
     void addChild(std::unique_ptr<UIElement> child);                ///< @brief 添加子元素
@@ -58,17 +70,29 @@ public:
     UIElement* getParent() const { return parent_; }                ///< @brief 获取父元素
     const std::vector<std::unique_ptr<UIElement>>& getChildren() const { return children_; } ///< @brief 获取子元素列表
 
-    void setSize(glm::vec2 size) { size_ = std::move(size); }           ///< @brief 设置元素大小
-    void setVisible(bool visible) { visible_ = visible; }           ///< @brief 设置元素的可见性
-    void setParent(UIElement* parent) { parent_ = parent; }         ///< @brief 设置父节点
-    void setPosition(glm::vec2 position) { position_ = std::move(position); }   ///< @brief 设置元素位置(相对于父节点)
+    void setSize(glm::vec2 size);                                   ///< @brief 设置元素大小
+    void setVisible(bool visible);                                  ///< @brief 设置元素的可见性
+    void setParent(UIElement* parent);                              ///< @brief 设置父节点
+    void setPosition(glm::vec2 position);                           ///< @brief 设置元素位置(相对于父节点)
     void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置元素是否需要移除
 
     // --- 辅助方法 ---
-    engine::utils::Rect getBounds() const;                          ///< @brief 获取(计算)元素的边界(屏幕坐标)
-    glm::vec2 getScreenPosition() const;                            ///< @brief 获取(计算)元素在屏幕上位置
+    engine::utils::Rect getBounds() const;                          ///< @brief 获取元素的边界(屏幕坐标)
+    glm::vec2 getScreenPosition() const;                            ///< @brief 获取元素在屏幕上位置(缓存未失效时为O(1))
     bool isPointInside(const glm::vec2& point) const;               ///< @brief 检查给定点是否在元素的边界内
 
+    // --- 重绘标记 ---
+    void markRenderDirty();                                         ///< @brief 标记所在的UI树需要重新录制绘制列表(置位于根节点)
+    bool isRenderDirty() const { return render_dirty_; }            ///< @brief (根节点)是否需要重新录制
+    void clearRenderDirty() { render_dirty_ = false; }              ///< @brief (根节点)录制完成后清除标记
+    void markLayoutDirty();                                         ///< @brief 标记所在的UI树布局变化(同时需要重绘)
+    bool isLayoutDirty() const { return layout_dirty_; }            ///< @brief (根节点)命中索引是否需要重建
+    void clearLayoutDirty() { layout_dirty_ = false; }              ///< @brief (根节点)重建完成后清除标记
+
+protected:
+    void invalidateScreenPosition();                                ///< @brief 使自身及所有子孙的屏幕位置缓存失效
+
+public:
     // --- 禁用拷贝和移动语义 ---
     UIElement(const UIElement&) = delete;
     UIElement& operator=(const UIElement&) = delete;
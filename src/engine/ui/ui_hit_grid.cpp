@@ -0,0 +1,84 @@
+#include "ui_hit_grid.h"
+#include "ui_element.h"
+#include "ui_interactive.h"
+#include <algorithm>
+#include <cmath>
+
+namespace engine::ui {
+
+void UIHitGrid::rebuild(UIElement& root) {
+    entries_.clear();
+    for (auto& cell : cells_) cell.clear();     // 保留每个格子的容量
+    columns_ = 0;
+    rows_ = 0;
+
+    collect(root);
+    if (entries_.empty()) return;
+
+    // 网格覆盖所有元素的包围盒
+    glm::vec2 min_point = entries_.front().bounds_.position;
+    glm::vec2 max_point = min_point;
+    for (const auto& entry : entries_) {
+        min_point.x = std::min(min_point.x, entry.bounds_.position.x);
+        min_point.y = std::min(min_point.y, entry.bounds_.position.y);
+        max_point.x = std::max(max_point.x, entry.bounds_.position.x + entry.bounds_.size.x);
+        max_point.y = std::max(max_point.y, entry.bounds_.position.y + entry.bounds_.size.y);
+    }
+    origin_ = min_point;
+    const glm::vec2 extent = {std::max(max_point.x - min_point.x, 1.0f), std::max(max_point.y - min_point.y, 1.0f)};
+    cell_size_ = {std::max(CELL_SIZE, extent.x / MAX_CELLS_PER_AXIS), std::max(CELL_SIZE, extent.y / MAX_CELLS_PER_AXIS)};
+    columns_ = static_cast<int>(std::ceil(extent.x / cell_size_.x));
+    rows_ = static_cast<int>(std::ceil(extent.y / cell_size_.y));
+    if (cells_.size() < static_cast<std::size_t>(columns_ * rows_)) {
+        cells_.resize(static_cast<std::size_t>(columns_ * rows_));
+    }
+
+    // 按z序登记，每个格子中的下标天然升序
+    for (int i = 0; i < static_cast<int>(entries_.size()); ++i) {
+        const auto& bounds = entries_[i].bounds_;
+        const int x0 = std::clamp(static_cast<int>((bounds.position.x - origin_.x) / cell_size_.x), 0, columns_ - 1);
+        const int y0 = std::clamp(static_cast<int>((bounds.position.y - origin_.y) / cell_size_.y), 0, rows_ - 1);
+        const int x1 = std::clamp(static_cast<int>((bounds.position.x + bounds.size.x - origin_.x) / cell_size_.x), 0, columns_ - 1);
+        const int y1 = std::clamp(static_cast<int>((bounds.position.y + bounds.size.y - origin_.y) / cell_size_.y), 0, rows_ - 1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                cells_[y * columns_ + x].push_back(i);
+            }
+        }
+    }
+}
+
+UIInteractive* UIHitGrid::hitTest(const glm::vec2& point) const {
+    if (columns_ == 0 || rows_ == 0) return nullptr;
+    const int x = static_cast<int>(std::floor((point.x - origin_.x) / cell_size_.x));
+    const int y = static_cast<int>(std::floor((point.y - origin_.y) / cell_size_.y));
+    if (x < 0 || y < 0 || x >= columns_ || y >= rows_) return nullptr;
+
+    // 从最上层开始检查
+    const auto& cell = cells_[y * columns_ + x];
+    for (auto it = cell.rbegin(); it != cell.rend(); ++it) {
+        const auto& entry = entries_[*it];
+        const auto& bounds = entry.bounds_;
+        if (point.x >= bounds.position.x && point.x < bounds.position.x + bounds.size.x &&
+            point.y >= bounds.position.y && point.y < bounds.position.y + bounds.size.y &&
+            !entry.element_->isNeedRemove()) {
+            return entry.element_;
+        }
+    }
+    return nullptr;
+}
+
+void UIHitGrid::collect(UIElement& element) {
+    if (!element.isVisible()) return;
+
+    // 自身先于子元素绘制，因此位于子元素之下
+    if (auto* interactive = dynamic_cast<UIInteractive*>(&element);
+        interactive && interactive->isInteractive()) {
+        entries_.push_back({interactive, element.getBounds()});
+    }
+    for (const auto& child : element.getChildren()) {
+        if (child) collect(*child);
+    }
+}
+
+} // namespace engine::ui
@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+#include <glm/vec2.hpp>
+#include "../utils/math.h"
+
+namespace engine::ui {
+class UIElement;
+class UIInteractive;
+
+/**
+ * @brief UI 命中测试的空间索引。
+ *
+ * 将UI树中所有可见且可交互的元素按绘制顺序(z序，后绘制的在上层)展平，
+ * 再按固定大小的格子划分它们的屏幕包围盒。查询时只检查指针所在格子中的元素，
+ * 开销与元素总数无关。只在布局变化(位置、大小、可见性、层级)后由 UIManager 重建。
+ */
+class UIHitGrid final {
+private:
+    static constexpr float CELL_SIZE = 64.0f;       ///< @brief 格子边长(逻辑像素)
+    static constexpr int MAX_CELLS_PER_AXIS = 128;  ///< @brief 每个方向的最大格子数(超大包围盒时放大格子)
+
+    /// @brief 一个可命中的元素及其重建时的屏幕边界
+    struct Entry {
+        UIInteractive* element_ = nullptr;
+        engine::utils::Rect bounds_;
+    };
+
+    std::vector<Entry> entries_;                    ///< @brief 按z序排列的元素(下标越大越靠上)
+    std::vector<std::vector<int>> cells_;           ///< @brief 每个格子中元素的下标(升序，即z序)
+    glm::vec2 origin_ = {0.0f, 0.0f};               ///< @brief 网格左上角(所有元素包围盒的最小点)
+    glm::vec2 cell_size_ = {CELL_SIZE, CELL_SIZE};  ///< @brief 实际的格子大小
+    int columns_ = 0;                               ///< @brief 列数
+    int rows_ = 0;                                  ///< @brief 行数
+
+public:
+    UIHitGrid() = default;
+
+    /**
+     * @brief 从根元素开始重建索引(跳过不可见的子树与不可交互的元素)
+     * @param root UI树的根元素
+     */
+    void rebuild(UIElement& root);
+
+    /**
+     * @brief 查找指定屏幕坐标下最上层的可交互元素
+     * @param point 屏幕(逻辑)坐标
+     * @return 最上层的元素，没有则返回 nullptr
+     */
+    UIInteractive* hitTest(const glm::vec2& point) const;
+
+    /// @brief 遍历所有已索引的元素(z序)
+    template <typename Func>
+    void forEachElement(Func&& func) const {
+        for (const auto& entry : entries_) func(entry.element_);
+    }
+
+    // 禁用拷贝和移动语义
+    UIHitGrid(const UIHitGrid&) = delete;
+    UIHitGrid& operator=(const UIHitGrid&) = delete;
+    UIHitGrid(UIHitGrid&&) = delete;
+    UIHitGrid& operator=(UIHitGrid&&) = delete;
+
+private:
+    void collect(UIElement& element);                         ///< @brief 深度优先收集元素(与渲染顺序一致)
+};
+
+} // namespace engine::ui
@@ -20,21 +20,21 @@ UIImage::UIImage(std::string_view texture_id,
     spdlog::trace("UIImage 构造完成");
 }
 
-void UIImage::render(engine::core::Context& context) {
+void UIImage::render(engine::render::UIDrawList& draw_list, engine::core::Context& context) {
     if (!visible_ || sprite_.getTextureId().empty()) {
         return; // 如果不可见或没有分配纹理则不渲染
     }
 
-    // 渲染自身
+    // 录制自身
     auto position = getScreenPosition();
     if (size_.x == 0.0f && size_.y == 0.0f) {   // 如果尺寸为0，则使用纹理的原始尺寸
-        context.getRenderer().drawUISprite(sprite_, position);
+        context.getRenderer().recordUISprite(draw_list, sprite_, position);
     } else {
-        context.getRenderer().drawUISprite(sprite_, position, size_);
+        context.getRenderer().recordUISprite(draw_list, sprite_, position, size_);
     }
 
-    // 渲染子元素（调用基类方法）
-    UIElement::render(context);
+    // 录制子元素（调用基类方法）
+    UIElement::render(draw_list, context);
 }
 
 } // namespace engine::ui 
\ No newline at end of file
@@ -34,20 +34,20 @@ public:
             bool is_flipped = false);
 
     // --- 核心方法 ---
-    void render(engine::core::Context& context) override;
+    void render(engine::render::UIDrawList& draw_list, engine::core::Context& context) override;
 
     // --- Setters & Getters ---
     const engine::render::Sprite& getSprite() const { return sprite_; }
-    void setSprite(engine::render::Sprite sprite) { sprite_ = std::move(sprite); }
+    void setSprite(engine::render::Sprite sprite) { sprite_ = std::move(sprite); markRenderDirty(); }
 
     std::string_view getTextureId() const { return sprite_.getTextureId(); }
-    void setTextureId(std::string_view texture_id) { sprite_.setTextureId(texture_id); }
+    void setTextureId(std::string_view texture_id) { sprite_.setTextureId(texture_id); markRenderDirty(); }
 
     const std::optional<SDL_FRect>& getSourceRect() const { return sprite_.getSourceRect(); }
-    void setSourceRect(std::optional<SDL_FRect> source_rect) { sprite_.setSourceRect(std::move(source_rect)); }
+    void setSourceRect(std::optional<SDL_FRect> source_rect) { sprite_.setSourceRect(std::move(source_rect)); markRenderDirty(); }
 
     bool isFlipped() const { return sprite_.isFlipped(); }
-    void setFlipped(bool flipped) { sprite_.setFlipped(flipped); }
+    void setFlipped(bool flipped) { sprite_.setFlipped(flipped); markRenderDirty(); }
 };
 
 } // namespace engine::ui
\ No newline at end of file
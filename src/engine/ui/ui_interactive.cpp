@@ -31,7 +31,7 @@ void UIInteractive::addSprite(std::string_view name, std::unique_ptr<engine::ren
 {
     // 可交互UI元素必须有一个size用于交互检测，因此如果参数列表中没有指定，则用图片大小作为size
     if (size_.x == 0.0f && size_.y == 0.0f) {
-        size_ = context_.getResourceManager().getTextureSize(sprite->getTextureId());
+        setSize(context_.getResourceManager().getTextureSize(sprite->getTextureId()));
     }
     // 添加精灵
     sprites_[std::string(name)] = std::move(sprite);
@@ -39,8 +39,10 @@ void UIInteractive::addSprite(std::string_view name, std::unique_ptr<engine::ren
 
 void UIInteractive::setSprite(std::string_view name)
 {
-    if (sprites_.find(std::string(name)) != sprites_.end()) {
-        current_sprite_ = sprites_[std::string(name)].get();
+    if (auto it = sprites_.find(std::string(name)); it != sprites_.end()) {
+        if (current_sprite_ == it->second.get()) return;
+        current_sprite_ = it->second.get();
+        markRenderDirty();
     } else {
         spdlog::warn("Sprite '{}' 未找到", name);
     }
@@ -60,31 +62,49 @@ void UIInteractive::playSound(std::string_view name)
     }
 }
 
+void UIInteractive::setInteractive(bool interactive)
+{
+    if (interactive_ == interactive) return;
+    interactive_ = interactive;
+    markLayoutDirty();      // 不可交互的元素不参与命中测试
+}
+
+bool UIInteractive::isIdle() const
+{
+    return !state_ || state_->isIdle();
+}
+
 bool UIInteractive::handleInput(engine::core::Context &context)
 {
-    if (UIElement::handleInput(context)) {  
-        return true;
-    }
+    return handlePointerEvent(context, engine::ui::state::UIPointerEvent::NONE);
+}
 
-    // 先更新子节点，再更新自己（状态）
-    if (state_ && interactive_) {
-        if (auto next_state = state_->handleInput(context); next_state) {
-            setState(std::move(next_state));
-            return true;
-        }
+bool UIInteractive::handlePointerEvent(engine::core::Context& context, engine::ui::state::UIPointerEvent event)
+{
+    // 由 UIManager 按命中测试直接调用，只处理自身状态。
+    // 切换后让新状态继续处理同一输入，例如指针移入的同时按下：正常 -> 悬停 -> 按下
+    constexpr int MAX_TRANSITIONS = 3;
+    bool changed = false;
+    for (int i = 0; i < MAX_TRANSITIONS && state_ && interactive_; ++i) {
+        auto next_state = state_->handleInput(context, event);
+        if (!next_state) break;
+        setState(std::move(next_state));
+        changed = true;
     }
-    return false;
+    return changed;
 }
 
-void UIInteractive::render(engine::core::Context &context)
+void UIInteractive::render(engine::render::UIDrawList& draw_list, engine::core::Context &context)
 {
     if (!visible_ ) return;
 
-    // 先渲染自身
-    context.getRenderer().drawUISprite(*current_sprite_, getScreenPosition(), size_);
+    // 先录制自身
+    if (current_sprite_) {
+        context.getRenderer().recordUISprite(draw_list, *current_sprite_, getScreenPosition(), size_);
+    }
 
-    // 再渲染子元素（调用基类方法）
-    UIElement::render(context);
+    // 再录制子元素（调用基类方法）
+    UIElement::render(draw_list, context);
 }
 
 } // namespace engine::ui
\ No newline at end of file
@@ -28,6 +28,7 @@ protected:
     std::unordered_map<std::string, std::string> sounds_;   ///< @brief 音效集合，key为音效名称，value为音效文件路径
     engine::render::Sprite* current_sprite_ = nullptr;      ///< @brief 当前显示的精灵
     bool interactive_ = true;                               ///< @brief 是否可交互
+    bool pointer_over_ = false;                             ///< @brief 指针是否位于本元素之上(且本元素为最上层)，由 UIManager 设置
 
 public:
     UIInteractive(engine::core::Context& context, glm::vec2 position = {0.0f, 0.0f}, glm::vec2 size = {0.0f, 0.0f});
@@ -43,12 +44,21 @@ public:
     void setState(std::unique_ptr<engine::ui::state::UIState> state);       ///< @brief 设置当前状态
     engine::ui::state::UIState* getState() const { return state_.get(); }   ///< @brief 获取当前状态
 
-    void setInteractive(bool interactive) { interactive_ = interactive; }   ///< @brief 设置是否可交互
+    void setInteractive(bool interactive);                                  ///< @brief 设置是否可交互
     bool isInteractive() const { return interactive_; }                     ///< @brief 获取是否可交互
+    void setPointerOver(bool pointer_over) { pointer_over_ = pointer_over; }    ///< @brief 设置指针是否位于本元素之上
+    bool isPointerOver() const { return pointer_over_; }                    ///< @brief 指针是否位于本元素之上(命中测试的结果)
+    bool isIdle() const;                                                    ///< @brief 是否处于空闲(正常)状态，非空闲的元素需要持续接收输入
 
     // --- 核心方法 ---
-    bool handleInput(engine::core::Context& context) override;
-    void render(engine::core::Context& context) override;
+    bool handleInput(engine::core::Context& context) override;     ///< @brief 处理一次没有按键跳变的指针更新
+
+    /**
+     * @brief 处理一次指针输入（由 UIManager 按本帧的输入事件顺序调用）
+     * @return 状态是否发生了切换
+     */
+    bool handlePointerEvent(engine::core::Context& context, engine::ui::state::UIPointerEvent event);
+    void render(engine::render::UIDrawList& draw_list, engine::core::Context& context) override;
 };
 
 } // namespace engine::ui
\ No newline at end of file
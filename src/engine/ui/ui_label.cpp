@@ -1,6 +1,7 @@
 #include "ui_label.h"
 #include "../core/context.h"
 #include "../render/text_renderer.h"
+#include "../render/ui_draw_list.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
@@ -17,42 +18,55 @@ UILabel::UILabel(engine::render::TextRenderer& text_renderer,
       font_id_(font_id),
       font_size_(font_size),
       text_fcolor_(std::move(text_color)) {
-    // 获取文本渲染尺寸
-    size_ = text_renderer_.getTextSize(text_, font_id_, font_size_);
+    // 创建持久文本并获取渲染尺寸
+    rebuildText();
     spdlog::trace("UILabel 构造完成");
 }
 
-void UILabel::render(engine::core::Context& context) {
+void UILabel::render(engine::render::UIDrawList& draw_list, engine::core::Context& context) {
     if (!visible_ || text_.empty()) return;
 
-    text_renderer_.drawUIText(text_, font_id_, font_size_, getScreenPosition(), text_fcolor_);
+    draw_list.addText(text_handle_, getScreenPosition(), text_fcolor_);
 
-    // 渲染子元素（调用基类方法）
-    UIElement::render(context);
+    // 录制子元素（调用基类方法）
+    UIElement::render(draw_list, context);
 }
 
 void UILabel::setText(std::string_view text)
 {
+    if (text_ == text) return;
     text_ = text;
-    size_ = text_renderer_.getTextSize(text_, font_id_, font_size_);
+    if (!text_renderer_.setText(text_handle_, text_)) {
+        rebuildText();
+        return;
+    }
+    setSize(text_renderer_.getTextSize(text_handle_));
+    markRenderDirty();      // 尺寸不变时文字内容也可能变化
 }
 
 void UILabel::setFontId(std::string_view font_id)
 {
     font_id_ = font_id;
-    size_ = text_renderer_.getTextSize(text_, font_id_, font_size_);
+    rebuildText();
 }
 
 void UILabel::setFontSize(int font_size)
 {
     font_size_ = font_size;
-    size_ = text_renderer_.getTextSize(text_, font_id_, font_size_);
+    rebuildText();
 }
 
 void UILabel::setTextFColor(engine::utils::FColor text_fcolor)
 {
     text_fcolor_ = std::move(text_fcolor);
-    /* 颜色变化不影响尺寸 */
+    markRenderDirty();      /* 颜色变化不影响尺寸 */
+}
+
+void UILabel::rebuildText()
+{
+    text_handle_ = text_renderer_.createText(text_, font_id_, font_size_);
+    setSize(text_renderer_.getTextSize(text_handle_));
+    markRenderDirty();
 }
 
 } // namespace engine::ui
\ No newline at end of file
@@ -23,6 +23,7 @@ private:
     std::string font_id_;                       ///< @brief 字体ID
     int font_size_;                             ///< @brief 字体大小   
     engine::utils::FColor text_fcolor_ = {1.0f, 1.0f, 1.0f, 1.0f};
+    engine::render::TextHandle text_handle_;    ///< @brief 持久文本句柄，仅在文本/字体变化时重新排版
     /* 可添加其他内容，例如边框、底色 */
 
 public:
@@ -43,7 +44,7 @@ public:
             glm::vec2 position = {0.0f, 0.0f});
 
     // --- 核心方法 ---
-    void render(engine::core::Context& context) override;
+    void render(engine::render::UIDrawList& draw_list, engine::core::Context& context) override;
 
     // --- Setters & Getters ---
     std::string_view getText() const { return text_; }
@@ -56,6 +57,9 @@ public:
     void setFontSize(int font_size);                            ///< @brief 设置字体大小, 同时更新尺寸
     void setTextFColor(engine::utils::FColor text_fcolor);
 
+private:
+    void rebuildText();                                         ///< @brief 重新创建文本句柄并更新尺寸（字体或大小改变时）
+
 };
 
 
@@ -1,6 +1,13 @@
 #include "ui_manager.h"
 #include "ui_panel.h"
 #include "ui_element.h"
+#include "ui_interactive.h"
+#include "ui_hit_grid.h"
+#include "../input/input_manager.h"
+#include "../core/context.h"
+#include "../render/ui_draw_list.h"
+#include "../debug/alloc_counter.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
@@ -8,8 +15,11 @@ namespace engine::ui {
 UIManager::~UIManager() = default;
 
 UIManager::UIManager() {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
     // 创建一个无特定大小和位置的Panel，它的子元素将基于它定位。
     root_element_ = std::make_unique<UIPanel>(glm::vec2{0.0f, 0.0f}, glm::vec2{0.0f, 0.0f});
+    draw_list_ = std::make_unique<engine::render::UIDrawList>();
+    hit_grid_ = std::make_unique<UIHitGrid>();
     spdlog::trace("UI管理器构造完成。");
 }
 
@@ -20,6 +30,7 @@ bool UIManager::init(const glm::vec2& window_size) {
 }   
 
 void UIManager::addElement(std::unique_ptr<UIElement> element) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
     if (root_element_) {
         root_element_->addChild(std::move(element));
     } else {
@@ -35,14 +46,63 @@ void UIManager::clearElements() {
 }
 
 bool UIManager::handleInput(engine::core::Context& context) {
-    if (root_element_ && root_element_->isVisible()) {
-        // 从根元素开始向下分发事件
-        if (root_element_->handleInput(context)) return true;
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
+    if (!root_element_ || !root_element_->isVisible()) return false;
+
+    auto& input_manager = context.getInputManager();
+    const auto mouse_left = input_manager.getActionId("mouse_left");
+    bool consumed = false;
+    for (const auto& event : input_manager.getInputEvents()) {
+        if (event.action_id_ != mouse_left || event.state_ == engine::input::ActionState::HELD) continue;
+        const auto pointer_event = event.state_ == engine::input::ActionState::PRESSED ? state::UIPointerEvent::PRESSED
+                                                                                       : state::UIPointerEvent::RELEASED;
+        consumed |= dispatchPointer(context, input_manager.toLogicalPosition(event.mouse_position_), pointer_event);
     }
-    return false;
+    consumed |= dispatchPointer(context, input_manager.getLogicalMousePosition(), state::UIPointerEvent::NONE);
+    return consumed;
+}
+
+bool UIManager::dispatchPointer(engine::core::Context& context, const glm::vec2& pointer, state::UIPointerEvent event) {
+    if (root_element_->isLayoutDirty()) rebuildHitGrid();
+
+    auto* target = hit_grid_->hitTest(pointer);
+    bool consumed = false;
+
+    // 先让仍处于悬停/按下状态的其他元素得知指针已离开(或鼠标已松开)，再处理指针下最上层的元素
+    for (auto* element : active_elements_) {
+        if (element == target) continue;
+        element->setPointerOver(false);
+        consumed |= element->handlePointerEvent(context, event);
+        if (root_element_->isLayoutDirty()) break;      // 回调修改了UI树，指针可能已失效
+    }
+    if (target && !root_element_->isLayoutDirty()) {
+        target->setPointerOver(true);
+        consumed |= target->handlePointerEvent(context, event);
+    }
+
+    if (root_element_->isLayoutDirty()) {
+        rebuildHitGrid();
+    } else {
+        std::erase_if(active_elements_, [](const UIInteractive* element) { return element->isIdle(); });
+        if (target && !target->isIdle() &&
+            std::find(active_elements_.begin(), active_elements_.end(), target) == active_elements_.end()) {
+            active_elements_.push_back(target);
+        }
+    }
+    return consumed;
+}
+
+void UIManager::rebuildHitGrid() {
+    hit_grid_->rebuild(*root_element_);
+    active_elements_.clear();
+    hit_grid_->forEachElement([this](UIInteractive* element) {
+        if (!element->isIdle()) active_elements_.push_back(element);
+    });
+    root_element_->clearLayoutDirty();
 }
 
 void UIManager::update(float delta_time, engine::core::Context& context) {
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
     if (root_element_ && root_element_->isVisible()) {
         // 从根元素开始向下更新
         root_element_->update(delta_time, context);
@@ -50,10 +110,16 @@ void UIManager::update(float delta_time, engine::core::Context& context) {
 }
 
 void UIManager::render(engine::core::Context& context) {
-    if (root_element_ && root_element_->isVisible()) {
-        // 从根元素开始向下渲染
-        root_element_->render(context);
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::UI);
+    if (!root_element_ || !root_element_->isVisible()) return;
+
+    // UI树有变化时才重新录制(从根元素开始向下)，否则直接提交上次的结果
+    if (root_element_->isRenderDirty()) {
+        draw_list_->clear();
+        root_element_->render(*draw_list_, context);
+        root_element_->clearRenderDirty();
     }
+    draw_list_->submit(context.getRenderer(), context.getTextRenderer());
 }
 
 UIPanel* UIManager::getRootElement() const {
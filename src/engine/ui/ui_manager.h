@@ -2,13 +2,19 @@
 #include <memory>
 #include <vector>
 #include <glm/vec2.hpp>
+#include "state/ui_state.h"
 
 namespace engine::core {
     class Context;
 }
+namespace engine::render {
+    class UIDrawList;
+}
 namespace engine::ui {
     class UIElement;
     class UIPanel; // UIPanel 将作为根元素
+    class UIInteractive;
+    class UIHitGrid;
 }
 
 namespace engine::ui {
@@ -18,10 +24,15 @@ namespace engine::ui {
  *
  * 负责UI元素的生命周期管理（通过根元素）、渲染调用和输入事件分发。
  * 每个需要UI的场景（如菜单、游戏HUD）应该拥有一个UIManager实例。
+ * 渲染使用保留式的绘制列表：只有UI树被标记为需要重绘时才重新录制，静态的HUD每帧只需提交几个批次。
+ * 指针输入通过命中索引(UIHitGrid)直接交给指针下最上层的可交互元素，索引只在布局变化后重建。
  */
 class UIManager final {
 private:
     std::unique_ptr<UIPanel> root_element_;     ///< @brief 一个UIPanel作为根节点(UI元素)
+    std::unique_ptr<engine::render::UIDrawList> draw_list_;    ///< @brief 上一次录制的绘制列表
+    std::unique_ptr<UIHitGrid> hit_grid_;                       ///< @brief 可交互元素的命中索引
+    std::vector<UIInteractive*> active_elements_;               ///< @brief 处于非空闲状态(悬停/按下)的元素，需要持续接收输入
 
 public:
     UIManager();        ///< @brief 构造函数将创建默认的根节点。
@@ -34,7 +45,13 @@ public:
     void clearElements();                                   ///< @brief 清除所有UI元素，通常用于重置UI状态。
 
     // --- 核心循环方法 ---
-    bool handleInput(engine::core::Context&);               ///< @brief 处理输入事件，如果事件被处理则返回true。
+    /**
+     * @brief 处理输入，如果事件被处理则返回true。
+     *
+     * 本帧左键的每次按下/释放按顺序、以发生时的指针位置逐个分发，
+     * 同一帧内完成的点击（按下+释放）也会被识别；最后再以当前指针位置更新一次悬停状态。
+     */
+    bool handleInput(engine::core::Context&);
     void update(float delta_time, engine::core::Context&);
     void render(engine::core::Context&);
 
@@ -44,6 +61,10 @@ public:
     UIManager(UIManager&&) = delete;
     UIManager& operator=(UIManager&&) = delete;
 
+private:
+    void rebuildHitGrid();                                  ///< @brief 重建命中索引，并从中重新收集非空闲的元素
+    bool dispatchPointer(engine::core::Context& context, const glm::vec2& pointer,
+                         engine::ui::state::UIPointerEvent event);   ///< @brief 以给定的指针位置分发一次指针输入
 };
 
 } // namespace engine::ui
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "ui_panel.h"
 #include "../core/context.h"
-#include "../render/renderer.h"
+#include "../render/ui_draw_list.h"
 #include <SDL3/SDL_pixels.h>
 #include <spdlog/spdlog.h>
 
@@ -12,14 +12,14 @@ UIPanel::UIPanel(glm::vec2 position, glm::vec2 size, std::optional<engine::utils
     spdlog::trace("UIPanel 构造完成。");
 }
 
-void UIPanel::render(engine::core::Context& context) {
+void UIPanel::render(engine::render::UIDrawList& draw_list, engine::core::Context& context) {
     if (!visible_) return;
 
     if (background_color_) {
-        context.getRenderer().drawUIFilledRect(getBounds(), background_color_.value());
+        draw_list.addFilledRect(getBounds(), background_color_.value());
     }
 
-    UIElement::render(context); // 调用基类渲染方法(绘制子节点)
+    UIElement::render(draw_list, context); // 调用基类录制方法(录制子节点)
 }
 
 } // namespace engine::ui 
\ No newline at end of file
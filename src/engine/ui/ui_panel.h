@@ -25,10 +25,10 @@ public:
     explicit UIPanel(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 size = {0.0f, 0.0f},
                      std::optional<engine::utils::FColor> background_color = std::nullopt);
 
-    void setBackgroundColor(std::optional<engine::utils::FColor> background_color) { background_color_ = std::move(background_color); }
+    void setBackgroundColor(std::optional<engine::utils::FColor> background_color) { background_color_ = std::move(background_color); markRenderDirty(); }
     const std::optional<engine::utils::FColor>& getBackgroundColor() const { return background_color_; }
 
-    void render(engine::core::Context& context) override;
+    void render(engine::render::UIDrawList& draw_list, engine::core::Context& context) override;
 };
 
 } // namespace engine::ui
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::utils {
+
+/// @brief parallelFor 使用的线程数（含调用线程），分批提交任务时可作为每批的任务数
+inline std::size_t workerCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief 用工作线程并行执行 job(0) ~ job(count - 1)，主线程也参与，全部完成后返回。
+ * 任务通过原子计数器领取（与 Preloader 的工作线程相同），线程数不超过硬件并发数。
+ * 每个任务应只写入属于自己下标的结果，调用者按下标顺序合并，结果即与串行执行一致。
+ *
+ * 任务抛出的异常不会终止进程：记录第一个异常，其余线程不再领取新任务，
+ * 等所有线程结束后在调用线程中重新抛出。
+ */
+template<typename Job>
+void parallelFor(std::size_t count, Job&& job) {
+    if (count == 0) return;
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&] {
+        for (auto i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                job(i);
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) error = std::current_exception();
+                next.store(count);      // 放弃剩余的任务
+                return;
+            }
+        }
+    };
+    const std::size_t extra = std::min(count, workerCount()) - 1;    // 主线程算作一个
+    std::vector<std::thread> threads;
+    threads.reserve(extra);
+    for (std::size_t i = 0; i < extra; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace engine::utils
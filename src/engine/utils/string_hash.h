@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace engine::utils {
+
+/**
+ * @brief 透明字符串哈希：与 std::equal_to<> 一起用于 std::unordered_map<std::string, T>，
+ * 可以直接用 std::string_view / const char* 查找，而不必先构造临时的 std::string（可能产生堆分配）。
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    std::size_t operator()(const std::string& key) const { return std::hash<std::string_view>{}(key); }
+    std::size_t operator()(const char* key) const { return std::hash<std::string_view>{}(key); }
+};
+
+} // namespace engine::utils
@@ -0,0 +1,171 @@
+#include "level_manifest.h"
+#include "../../engine/resource/resource_manager.h"
+#include "../../engine/debug/alloc_counter.h"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <string>
+
+namespace game::data {
+
+namespace {
+
+constexpr std::string_view LEVEL_CONFIG_PATH = "assets/data/level_config.json";
+constexpr std::string_view ENEMY_DATA_PATH = "assets/data/enemy_data.json";
+constexpr std::string_view PROJECTILE_DATA_PATH = "assets/data/projectile_data.json";
+constexpr std::string_view EFFECT_DATA_PATH = "assets/data/effect_data.json";
+constexpr std::string_view BATTLE_MUSIC_ID = "battle_bgm";
+constexpr int DEFAULT_FONT_SIZE = 16;
+
+/// @brief 读取 JSON 文件，失败返回 null 并记录错误
+nlohmann::json readJson(const engine::resource::ResourceManager& resource_manager, std::string_view path)
+{
+    engine::debug::AllocScope alloc_scope(engine::debug::AllocTag::LOADER);
+    auto text = resource_manager.readTextFile(path);    // 优先从资源包读取
+    if (!text) {
+        spdlog::error("预加载清单: 无法打开文件 '{}'。", path);
+        return nullptr;
+    }
+    try {
+        return nlohmann::json::parse(*text);
+    } catch (const std::exception& e) {
+        spdlog::error("预加载清单: 解析 '{}' 失败: {}", path, e.what());
+        return nullptr;
+    }
+}
+
+/// @brief 与 LevelLoader::resolvePath 相同的规则：相对于 file_path 所在目录，并规范化
+std::string resolveRelative(std::string_view relative_path, std::string_view file_path)
+{
+    std::error_code ec;
+    auto final_path = std::filesystem::weakly_canonical(std::filesystem::path(file_path).parent_path() / relative_path, ec);
+    return ec ? std::string(relative_path) : final_path.string();
+}
+
+/// @brief 递归收集所有 "sprite_sheet" 纹理与 "font_path" 字体
+void collectSpriteSheetsAndFonts(const nlohmann::json& json, engine::resource::PreloadManifest& manifest)
+{
+    if (json.is_object()) {
+        if (auto it = json.find("sprite_sheet"); it != json.end() && it->is_string()) {
+            manifest.addTexture(it->get<std::string>());
+        }
+        if (auto it = json.find("font_path"); it != json.end() && it->is_string()) {
+            manifest.addFont(it->get<std::string>(), json.value("font_size", DEFAULT_FONT_SIZE));
+        }
+    }
+    if (json.is_structured()) {
+        for (const auto& child : json) collectSpriteSheetsAndFonts(child, manifest);
+    }
+}
+
+/// @brief 收集实体数据中的 "sounds" 音效（ID 经资源映射解析为路径）
+void collectSounds(const nlohmann::json& entity, const engine::resource::ResourceManager& resource_manager,
+                   engine::resource::PreloadManifest& manifest)
+{
+    auto it = entity.find("sounds");
+    if (it == entity.end() || !it->is_object()) return;
+    for (const auto& sound_id : *it) {
+        if (sound_id.is_string()) manifest.addSound(resource_manager.resolvePath(sound_id.get<std::string>()));
+    }
+}
+
+/// @brief 收集单位/敌人：精灵表、音效及其投射物
+void collectEntity(const nlohmann::json& entity, const nlohmann::json& projectile_data,
+                   const engine::resource::ResourceManager& resource_manager, engine::resource::PreloadManifest& manifest)
+{
+    manifest.addTexture(entity.value("sprite_sheet", ""));
+    collectSounds(entity, resource_manager, manifest);
+
+    auto projectile_name = entity.value("projectile", "");
+    if (!projectile_name.empty() && projectile_data.contains(projectile_name)) {
+        const auto& projectile = projectile_data[projectile_name];
+        manifest.addTexture(projectile.value("sprite_sheet", ""));
+        collectSounds(projectile, resource_manager, manifest);
+    }
+}
+
+/// @brief 收集地图（图片图层与图块集）引用的纹理
+void collectMap(const engine::resource::ResourceManager& resource_manager, std::string_view map_path,
+                engine::resource::PreloadManifest& manifest)
+{
+    auto map_json = readJson(resource_manager, map_path);
+    if (map_json.is_null()) return;
+
+    for (const auto& layer : map_json.value("layers", nlohmann::json::array())) {
+        if (layer.value("type", "") == "imagelayer" && layer.contains("image")) {
+            manifest.addTexture(resolveRelative(layer["image"].get<std::string>(), map_path));
+        }
+    }
+    for (const auto& tileset_ref : map_json.value("tilesets", nlohmann::json::array())) {
+        if (!tileset_ref.contains("source")) continue;
+        auto tileset_path = resolveRelative(tileset_ref["source"].get<std::string>(), map_path);
+        auto tileset_json = readJson(resource_manager, tileset_path);
+        if (tileset_json.is_null()) continue;
+
+        if (tileset_json.contains("image")) {       // 单一图片
+            manifest.addTexture(resolveRelative(tileset_json["image"].get<std::string>(), tileset_path));
+        }
+        for (const auto& tile : tileset_json.value("tiles", nlohmann::json::array())) {     // 多图片
+            if (tile.contains("image")) {
+                manifest.addTexture(resolveRelative(tile["image"].get<std::string>(), tileset_path));
+            }
+        }
+    }
+}
+
+} // namespace
+
+engine::resource::PreloadManifest buildLevelManifest(const engine::resource::ResourceManager& resource_manager,
+                                                     int level_index, std::string_view save_path)
+{
+    engine::resource::PreloadManifest manifest;
+
+    auto level_config = readJson(resource_manager, LEVEL_CONFIG_PATH);
+    auto enemy_data = readJson(resource_manager, ENEMY_DATA_PATH);
+    auto player_data = readJson(resource_manager, PLAYER_DATA_PATH);
+    auto projectile_data = readJson(resource_manager, PROJECTILE_DATA_PATH);
+    auto save_data = readJson(resource_manager, save_path);
+
+    // 1. 关卡：地图与各波次敌人
+    if (level_config.is_array() && level_index >= 0 && level_index < static_cast<int>(level_config.size())) {
+        const auto& level = level_config[level_index];
+        if (level.contains("map_path")) collectMap(resource_manager, level["map_path"].get<std::string>(), manifest);
+
+        for (const auto& wave : level.value("waves", nlohmann::json::array())) {
+            auto enemy_types = wave.value("enemy_types", nlohmann::json::object());
+            for (const auto& [enemy_type, count] : enemy_types.items()) {
+                if (enemy_data.contains(enemy_type)) {
+                    collectEntity(enemy_data[enemy_type], projectile_data, resource_manager, manifest);
+                } else {
+                    spdlog::warn("预加载清单: 未知的敌人类型 '{}'。", enemy_type);
+                }
+            }
+        }
+    } else {
+        spdlog::error("预加载清单: 关卡下标 {} 无效。", level_index);
+    }
+
+    // 2. 存档中的单位阵容
+    if (save_data.is_object()) {
+        for (const auto& unit : save_data.value("unit", nlohmann::json::object())) {
+            auto unit_class = unit.value("class", "");
+            if (player_data.contains(unit_class)) {
+                collectEntity(player_data[unit_class], projectile_data, resource_manager, manifest);
+            }
+        }
+    }
+
+    // 3. 特效与 UI（数量少，全部预加载）
+    collectSpriteSheetsAndFonts(readJson(resource_manager, EFFECT_DATA_PATH), manifest);
+    collectSpriteSheetsAndFonts(readJson(resource_manager, UI_CONFIG_PATH), manifest);
+
+    // 4. 战斗音乐
+    manifest.addMusic(resource_manager.resolvePath(BATTLE_MUSIC_ID));
+
+    manifest.removeDuplicates();
+    spdlog::debug("关卡 {} 的预加载清单: 纹理 {}，音效 {}，音乐 {}，字体 {}。", level_index,
+                  manifest.textures_.size(), manifest.sounds_.size(), manifest.music_.size(), manifest.fonts_.size());
+    return manifest;
+}
+
+} // namespace game::data
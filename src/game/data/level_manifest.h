@@ -0,0 +1,31 @@
+#pragma once
+#include "../../engine/resource/preload_manifest.h"
+#include <string_view>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace game::data {
+
+inline constexpr std::string_view PLAYER_DATA_PATH = "assets/data/player_data.json";   ///< @brief 玩家单位数据
+inline constexpr std::string_view UI_CONFIG_PATH = "assets/data/ui_config.json";       ///< @brief UI 描述（区域与布局）
+inline constexpr std::string_view DEFAULT_SAVE_PATH = "assets/save/SLOT_1.json";       ///< @brief 默认存档
+
+/**
+ * @brief 生成某一关卡的预加载清单。
+ *
+ * 遍历关卡配置（地图图层与图块集、各波次的敌人类型）、存档中的单位阵容，
+ * 以及它们引用的投射物、音效（经 resource_mapping.json 解析）、特效与 UI 资源，
+ * 收集全部纹理、音效、音乐与字体。地图相关路径与 LevelLoader 一样规范化，保证缓存键一致。
+ *
+ * @param resource_manager 用于把音效/音乐ID解析为路径。
+ * @param level_index 关卡下标（level_config.json 数组中的位置）。
+ * @param save_path 存档路径（读取其中的 "unit" 阵容）。
+ * @return 预加载清单；读取失败的文件会被跳过并记录错误。
+ */
+engine::resource::PreloadManifest buildLevelManifest(const engine::resource::ResourceManager& resource_manager,
+                                                     int level_index,
+                                                     std::string_view save_path = DEFAULT_SAVE_PATH);
+
+} // namespace game::data
@@ -2,9 +2,52 @@
 #include <spdlog/spdlog.h>
 #include "../../engine/core/context.h"
 #include "../../engine/input/input_manager.h"
+#include "../../engine/audio/audio_player.h"
+#include "../../engine/resource/resource_manager.h"
+#include "../../engine/render/camera.h"
+#include "../../engine/ui/ui_manager.h"
+#include "../../engine/ui/ui_panel.h"
+#include "../../engine/ui/ui_image.h"
+#include "../../engine/ui/ui_label.h"
+#include "../../engine/ui/ui_config.h"
+#include "../data/level_manifest.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
 
-CGameScene::CGameScene(engine::core::Context& vContext, engine::scene::SceneManager& vSceneManager)
-    : Scene("GameScene", vContext, vSceneManager)
+namespace {
+constexpr std::string_view LEVEL_CONFIG_PATH = "assets/data/level_config.json";
+constexpr std::string_view ENEMY_DATA_PATH = "assets/data/enemy_data.json";
+constexpr std::string_view UNIT_CARD_LAYOUT = "unit_card";
+constexpr float UNIT_CARD_PADDING = 10.0f;                                          ///< @brief 卡片之间的间距（与 unit_panel.padding 一致）
+constexpr std::array<std::string_view, 2> RARITY_FRAMES = {"common", "rare"};       ///< @brief 稀有度 1、2 对应的头像边框
+
+/// @brief 读取 JSON 文件，失败返回 null 并记录错误
+nlohmann::json readJson(engine::resource::ResourceManager& vResourceManager, std::string_view vPath)
+{
+    auto text = vResourceManager.readTextFile(vPath);
+    if (!text) {
+        spdlog::error("无法打开文件: {}", vPath);
+        return nullptr;
+    }
+    try {
+        return nlohmann::json::parse(*text);
+    } catch (const std::exception& e) {
+        spdlog::error("解析 '{}' 失败: {}", vPath, e.what());
+        return nullptr;
+    }
+}
+
+bool isSamePath(std::string_view lhs, std::string_view rhs)
+{
+    return std::filesystem::path(lhs).lexically_normal() == std::filesystem::path(rhs).lexically_normal();
+}
+}
+
+CGameScene::CGameScene(engine::core::Context& vContext, engine::scene::SceneManager& vSceneManager, int vLevelIndex)
+    : Scene("GameScene", vContext, vSceneManager),
+      level_index_(vLevelIndex)
 {
 }
 
@@ -14,9 +57,25 @@ CGameScene::~CGameScene()
 
 void CGameScene::init()
 {
+    context_.getAudioPlayer().prefetchMusic("battle_bgm");     // 预取战斗音乐，开战时可立即播放
     auto& input_manager = context_.getInputManager();
     input_manager.onAction("attack").connect<&CGameScene::onAttack>(this);
     input_manager.onAction("jump", engine::input::ActionState::RELEASED).connect<&CGameScene::onJump>(this);
+    context_.getResourceManager().onFileReload().connect<&CGameScene::onFileReload>(this);
+    loadEnemyData();
+    if (!ui_config_) {      // UI 描述只加载一次，纹理已由加载场景预加载
+        ui_config_ = std::make_unique<engine::ui::UIConfig>(context_.getResourceManager());
+        if (ui_config_->load(game::data::UI_CONFIG_PATH)) {
+            createUnitCards();
+        }
+    }
+    Scene::init();
+}
+
+void CGameScene::update(float vDeltaTime)
+{
+    layoutUnitCards(false);     // 视口大小未变化时直接返回
+    Scene::update(vDeltaTime);
 }
 
 void CGameScene::clean()
@@ -24,6 +83,126 @@ void CGameScene::clean()
     auto& input_manager = context_.getInputManager();
     input_manager.onAction("attack").disconnect<&CGameScene::onAttack>(this);
     input_manager.onAction("jump", engine::input::ActionState::RELEASED).disconnect<&CGameScene::onJump>(this);
+    context_.getResourceManager().onFileReload().disconnect<&CGameScene::onFileReload>(this);
+    unit_cards_.clear();        // 元素由 UIManager 持有，随场景一起清理
+    Scene::clean();
+}
+
+bool CGameScene::beginLevel()
+{
+    auto text = context_.getResourceManager().readTextFile(LEVEL_CONFIG_PATH);
+    if (!text) {
+        spdlog::error("无法打开关卡配置文件: {}", LEVEL_CONFIG_PATH);
+        return false;
+    }
+    std::string map_path;
+    try {
+        auto level_config = nlohmann::json::parse(*text);
+        if (!level_config.is_array() || level_index_ < 0 || level_index_ >= static_cast<int>(level_config.size())) {
+            spdlog::error("关卡下标 {} 无效。", level_index_);
+            return false;
+        }
+        map_path = level_config[level_index_].value("map_path", "");
+    } catch (const std::exception& e) {
+        spdlog::error("解析关卡配置文件 '{}' 失败: {}", LEVEL_CONFIG_PATH, e.what());
+        return false;
+    }
+    return level_loader_.beginLevel(map_path, *this);
+}
+
+bool CGameScene::loadEnemyData(bool vFromDisk)
+{
+    auto& resource_manager = context_.getResourceManager();
+    auto text = vFromDisk ? resource_manager.readLooseTextFile(ENEMY_DATA_PATH) : resource_manager.readTextFile(ENEMY_DATA_PATH);
+    if (!text) {
+        spdlog::error("无法打开敌人数据文件: {}", ENEMY_DATA_PATH);
+        return false;
+    }
+    try {
+        enemy_data_ = nlohmann::json::parse(*text);
+    } catch (const std::exception& e) {
+        spdlog::error("解析敌人数据文件 '{}' 失败: {}", ENEMY_DATA_PATH, e.what());  // 保留旧数据，保存了一半的文件不会清空
+        return false;
+    }
+    return true;
+}
+
+void CGameScene::onFileReload(std::string_view vFilePath)
+{
+    if (level_loader_.dependsOn(vFilePath)) {
+        level_loader_.reloadLayers(*this);
+    } else if (isSamePath(vFilePath, ENEMY_DATA_PATH)) {
+        if (loadEnemyData(true)) spdlog::info("敌人数据热重载完成: {}", ENEMY_DATA_PATH);
+    }
+}
+
+void CGameScene::createUnitCards()
+{
+    if (!ui_config_->hasLayout(UNIT_CARD_LAYOUT)) {
+        spdlog::error("UI 配置中没有布局 '{}'。", UNIT_CARD_LAYOUT);
+        return;
+    }
+    auto& resource_manager = context_.getResourceManager();
+    const auto save_data = readJson(resource_manager, game::data::DEFAULT_SAVE_PATH);
+    const auto player_data = readJson(resource_manager, game::data::PLAYER_DATA_PATH);
+    if (!save_data.is_object() || !player_data.is_object()) return;
+
+    const int portrait = ui_config_->findNode(UNIT_CARD_LAYOUT, "portrait");
+    const int frame = ui_config_->findNode(UNIT_CARD_LAYOUT, "frame");
+    const int icon = ui_config_->findNode(UNIT_CARD_LAYOUT, "icon");
+    const int cost = ui_config_->findNode(UNIT_CARD_LAYOUT, "cost");
+
+    ui_config_->relayout(context_.getCamera().getViewportSize());
+    for (const auto& [name, unit] : save_data.value("unit", nlohmann::json::object()).items()) {
+        const auto unit_class = unit.value("class", "");
+        auto& views = unit_cards_.emplace_back();
+        if (!ui_config_->instantiate(UNIT_CARD_LAYOUT, *ui_manager_->getRootElement(), context_, &views)) {
+            unit_cards_.pop_back();
+            continue;
+        }
+
+        // 用单位的实际数据替换布局中的占位内容
+        auto as_image = [&views](int vIndex) { return vIndex >= 0 ? dynamic_cast<engine::ui::UIImage*>(views[vIndex]) : nullptr; };
+        if (auto* image = as_image(portrait)) {
+            ui_config_->applyRegion(*image, "portrait/" + name);
+        }
+        if (auto* image = as_image(frame)) {
+            const auto rarity = std::clamp(unit.value("rarity", 1), 1, static_cast<int>(RARITY_FRAMES.size()));
+            ui_config_->applyRegion(*image, "portrait_frame/" + std::string(RARITY_FRAMES[rarity - 1]));
+        }
+        if (auto* image = as_image(icon)) {
+            ui_config_->applyRegion(*image, "icon/" + unit_class);
+        }
+        if (auto* label = cost >= 0 ? dynamic_cast<engine::ui::UILabel*>(views[cost]) : nullptr) {
+            const int unit_cost = player_data.contains(unit_class) ? player_data[unit_class].value("cost", 0) : 0;
+            char buffer[16];
+            auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), unit_cost);
+            label->setText(std::string_view(buffer, end - buffer));
+        }
+    }
+    layoutUnitCards(true);
+    spdlog::info("已创建 {} 张单位卡片。", unit_cards_.size());
+}
+
+void CGameScene::layoutUnitCards(bool vForce)
+{
+    if (!ui_config_ || unit_cards_.empty()) return;
+    if (!ui_config_->relayout(context_.getCamera().getViewportSize()) && !vForce) return;
+
+    // 布局给出单张卡片的位置（底部居中），再按顺序横向排开，一行放不下时向上换行
+    const auto viewport = context_.getCamera().getViewportSize();
+    const glm::vec2 card_size = unit_cards_.front().front()->getSize();
+    const glm::vec2 step = card_size + glm::vec2(UNIT_CARD_PADDING);
+    const auto per_row = static_cast<std::size_t>(std::max(1.0f, (viewport.x + UNIT_CARD_PADDING) / step.x));
+    for (std::size_t i = 0; i < unit_cards_.size(); ++i) {
+        const std::size_t row = i / per_row;
+        const std::size_t row_count = std::min(per_row, unit_cards_.size() - row * per_row);
+        const float column = static_cast<float>(i % per_row) - static_cast<float>(row_count - 1) / 2.0f;
+
+        ui_config_->applyLayout(UNIT_CARD_LAYOUT, unit_cards_[i]);
+        auto* card = unit_cards_[i].front();
+        card->setPosition(card->getPosition() + glm::vec2(step.x * column, -step.y * static_cast<float>(row)));
+    }
 }
 
 void CGameScene::onAttack()
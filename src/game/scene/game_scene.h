@@ -1,15 +1,41 @@
 #include "../../engine/scene/scene.h"
+#include "../../engine/scene/level_loader.h"
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace engine::ui {
+    class UIConfig;
+    class UIElement;
+}
 
 class CGameScene : public engine::scene::Scene
 {
 public:
-    CGameScene(engine::core::Context& vContext, engine::scene::SceneManager& vSceneManager);
+    CGameScene(engine::core::Context& vContext, engine::scene::SceneManager& vSceneManager, int vLevelIndex = 0);
     ~CGameScene();
 
     void init() override;
+    void update(float vDeltaTime) override;
     void clean() override;
 
+    /// @brief 开始增量加载本关地图（之后由加载场景每帧调用 getLevelLoader().update() 完成）
+    bool beginLevel();
+    engine::scene::LevelLoader& getLevelLoader() { return level_loader_; }
+    const nlohmann::json& getEnemyData() const { return enemy_data_; }     ///< @brief 敌人数据（enemy_data.json）
+
 private:
     void onAttack();
     void onJump();
+    void onFileReload(std::string_view vFilePath);  ///< @brief 热重载：地图/tileset 变化时重建图层，数据 JSON 变化时重新读取
+    bool loadEnemyData(bool vFromDisk = false);     ///< @brief 读取 enemy_data.json 到 enemy_data_（vFromDisk: 热重载时读取磁盘上的散文件）
+    void createUnitCards();                         ///< @brief 按存档中的单位阵容实例化单位卡片（头像、边框、职业图标、费用）
+    void layoutUnitCards(bool vForce);              ///< @brief 视口大小变化（或 vForce）时重新布局并横向排列单位卡片
+
+    int level_index_ = 0;                       ///< @brief 关卡下标（level_config.json 数组中的位置）
+    engine::scene::LevelLoader level_loader_;   ///< @brief 关卡地图加载器
+    nlohmann::json enemy_data_;                 ///< @brief 敌人数据，热重载时重新读取（暂无使用者，供之后的敌人生成逻辑读取）
+    std::unique_ptr<engine::ui::UIConfig> ui_config_;               ///< @brief UI 描述（场景初始化时加载一次）
+    std::vector<std::vector<engine::ui::UIElement*>> unit_cards_;   ///< @brief 每张单位卡片的元素（与 unit_card 布局的节点一一对应）
 };
\ No newline at end of file
@@ -1,21 +1,42 @@
 #include "engine/core/game_app.h"
 #include "engine/scene/scene_manager.h"
+#include "engine/scene/loading_scene.h"
+#include "engine/core/context.h"
+#include "engine/resource/preloader.h"
 #include "game/scene/game_scene.h"
+#include "game/data/level_manifest.h"
+#include "engine/debug/log.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_main.h>
 
 void setupInitialScene(engine::scene::SceneManager& scene_manager) {
-    // GameApp在调用run方法之前，先创建并设置初始场景
-    auto game_scene = std::make_unique<CGameScene>(scene_manager.getContext(), scene_manager);
-    scene_manager.requestPushScene(std::move(game_scene));
+    // GameApp在调用run方法之前，先设置初始场景：第一关在后台准备（预加载全部资源并分帧生成关卡对象），期间显示加载场景
+    auto& context = scene_manager.getContext();
+    auto& resource_manager = context.getResourceManager();
+    auto preloader = std::make_unique<engine::resource::Preloader>(resource_manager, game::data::buildLevelManifest(resource_manager, 0));
+    auto game_scene = std::make_unique<CGameScene>(context, scene_manager, 0);
+    auto* level = game_scene.get();     // 准备期间场景由场景管理器持有，指针保持有效
+    engine::scene::SceneManager::LoadTask load_task;
+    engine::scene::SceneManager::ProgressQuery load_progress;
+    if (level->beginLevel()) {          // 只记录地图路径；资源预加载完成后，分帧读取地图、解码瓦片并生成关卡对象
+        load_task = [level](float budget_ms) { return level->getLevelLoader().update(budget_ms); };
+        load_progress = [level] { return level->getLevelLoader().getProgress(); };
+    }
+    scene_manager.requestPreloadScene(std::move(game_scene), std::move(preloader), std::move(load_task), true, std::move(load_progress));
+    scene_manager.requestPushScene(std::make_unique<engine::scene::LoadingScene>(context, scene_manager));
 }
 
 
 int main(int /* argc */, char* /* argv */[]) {
     spdlog::set_level(spdlog::level::info);
+    engine::debug::initAsyncLogger();   // 异步输出日志，避免游戏线程阻塞在控制台 IO 上
 
-    engine::core::GameApp app;
-    app.registerSceneSetup(setupInitialScene);
-    app.run();
+    {
+        engine::core::GameApp app;
+        app.registerSceneSetup(setupInitialScene);
+        app.run();
+    }   // 确保 GameApp 析构（及其日志）在日志线程关闭前完成
+
+    engine::debug::shutdownLogger();
     return 0;
 }
\ No newline at end of file
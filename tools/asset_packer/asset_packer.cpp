@@ -0,0 +1,123 @@
+/**
+ * @brief 资源打包工具：把资源目录打包为一个 .pak 文件（格式见 src/engine/resource/pack_format.h）。
+ *
+ * 用法: asset_packer <资源目录> <输出文件>
+ * 例如: asset_packer assets build/assets.pak
+ * 包内路径为 "<资源目录名>/<相对路径>"（正斜杠），与游戏中使用的路径一致。
+ * 存档目录 (save/) 与 config.json 需要写入，不会被打包。
+ */
+#include "../../src/engine/resource/pack_format.h"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+namespace pack = engine::resource::pack;
+
+namespace {
+
+struct PackedFile {
+    std::string path_;
+    std::uint64_t offset_ = 0;
+    std::uint64_t size_ = 0;
+};
+
+/// @brief 是否跳过该文件（运行时需要写入的文件）
+bool shouldSkip(const fs::path& relative_path) {
+    auto first = relative_path.begin();
+    if (first != relative_path.end() && *first == "save") return true;
+    return relative_path == "config.json";
+}
+
+template <typename T>
+void writeValue(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void padTo(std::ofstream& out, std::uint64_t alignment) {
+    auto position = static_cast<std::uint64_t>(out.tellp());
+    auto padding = (alignment - position % alignment) % alignment;
+    for (std::uint64_t i = 0; i < padding; ++i) out.put('\0');
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "用法: asset_packer <资源目录> <输出文件>\n";
+        return 1;
+    }
+    const fs::path source_dir = fs::path(argv[1]).lexically_normal();
+    const fs::path output_path = argv[2];
+    if (!fs::is_directory(source_dir)) {
+        std::cerr << "资源目录不存在: " << source_dir << "\n";
+        return 1;
+    }
+    const fs::path prefix = source_dir.filename().empty() ? source_dir.parent_path().filename() : source_dir.filename();
+
+    // 1. 收集文件并排序，保证输出稳定
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::recursive_directory_iterator(source_dir)) {
+        if (!entry.is_regular_file()) continue;
+        if (shouldSkip(entry.path().lexically_relative(source_dir))) continue;
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::ofstream out(output_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "无法写入: " << output_path << "\n";
+        return 1;
+    }
+
+    // 2. 先写占位文件头，再依次写入文件数据
+    pack::PackHeader header;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<PackedFile> packed;
+    packed.reserve(files.size());
+    std::vector<char> buffer;
+    for (const auto& file_path : files) {
+        std::ifstream in(file_path, std::ios::binary);
+        if (!in) {
+            std::cerr << "无法读取: " << file_path << "\n";
+            return 1;
+        }
+        buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+        padTo(out, pack::PACK_ALIGNMENT);
+        PackedFile item;
+        item.path_ = (prefix / file_path.lexically_relative(source_dir)).generic_string();
+        item.offset_ = static_cast<std::uint64_t>(out.tellp());
+        item.size_ = buffer.size();
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        packed.push_back(std::move(item));
+    }
+
+    // 3. 写入目录
+    padTo(out, pack::PACK_ALIGNMENT);
+    header.toc_offset_ = static_cast<std::uint64_t>(out.tellp());
+    header.entry_count_ = static_cast<std::uint32_t>(packed.size());
+    for (const auto& item : packed) {
+        writeValue<std::uint64_t>(out, pack::hashPath(item.path_));
+        writeValue<std::uint64_t>(out, item.offset_);
+        writeValue<std::uint64_t>(out, item.size_);
+        writeValue<std::uint32_t>(out, static_cast<std::uint32_t>(item.path_.size()));
+        out.write(item.path_.data(), static_cast<std::streamsize>(item.path_.size()));
+    }
+
+    // 4. 回填文件头
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!out) {
+        std::cerr << "写入失败: " << output_path << "\n";
+        return 1;
+    }
+
+    std::cout << "已打包 " << packed.size() << " 个文件到 " << output_path << "\n";
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @brief 音效预处理工具：把资源映射文件中的全部音效解码为混音器设备格式的 PCM（格式见 src/engine/resource/cooked_audio.h）。
+ *
+ * 用法: audio_cooker <资源映射文件> [采样率 声道数]
+ * 例如: audio_cooker assets/data/resource_mapping.json
+ * 需要在项目根目录运行（映射中的路径相对于它），输出到 assets/cooked/。
+ * 默认使用与游戏相同的方式打开默认音频设备 (Mix_OpenAudio(0, nullptr))，得到设备的原生格式；
+ * 运行时格式不一致的预处理文件会被忽略，自动回退到原始文件。
+ * 完成后输出每个音效"解码原始文件"与"读取预处理 PCM"的耗时对比。
+ */
+#include "../../src/engine/resource/cooked_audio.h"
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+namespace cooked = engine::resource::cooked;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// @brief 写入预处理文件
+bool writeCooked(const std::string& path, const cooked::CookedAudioHeader& header, const Mix_Chunk* chunk) {
+    fs::create_directories(fs::path(path).parent_path());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(chunk->abuf), chunk->alen);
+    return static_cast<bool>(out);
+}
+
+/// @brief 按运行时的快速路径读取预处理文件（读取文件 + 拷贝为 Mix_Chunk），用于测量耗时
+Mix_Chunk* loadCooked(const std::string& path) {
+    SDL_IOStream* io = SDL_IOFromFile(path.c_str(), "rb");
+    if (!io) return nullptr;
+    cooked::CookedAudioHeader header;
+    Mix_Chunk* chunk = nullptr;
+    if (SDL_ReadIO(io, &header, sizeof(header)) == sizeof(header)) {
+        auto* buffer = static_cast<Uint8*>(SDL_malloc(header.data_size_));
+        if (buffer && SDL_ReadIO(io, buffer, header.data_size_) == header.data_size_) {
+            chunk = Mix_QuickLoad_RAW(buffer, static_cast<Uint32>(header.data_size_));
+        }
+        if (chunk) chunk->allocated = 1;
+        else SDL_free(buffer);
+    }
+    SDL_CloseIO(io);
+    return chunk;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 2 && argc != 4) {
+        std::cerr << "用法: audio_cooker <资源映射文件> [采样率 声道数]\n";
+        return 1;
+    }
+
+    std::ifstream mapping_file(argv[1]);
+    if (!mapping_file) {
+        std::cerr << "无法打开资源映射文件: " << argv[1] << "\n";
+        return 1;
+    }
+    nlohmann::json mapping;
+    try {
+        mapping = nlohmann::json::parse(mapping_file);
+    } catch (const std::exception& e) {
+        std::cerr << "解析资源映射文件失败: " << e.what() << "\n";
+        return 1;
+    }
+    std::vector<std::string> sounds;
+    for (const auto& [id, path] : mapping.value("sound", nlohmann::json::object()).items()) {
+        if (path.is_string()) sounds.push_back(path.get<std::string>());
+    }
+
+    // 1. 打开音频设备，得到混音器格式
+    if (!SDL_Init(SDL_INIT_AUDIO)) {
+        std::cerr << "SDL 初始化失败: " << SDL_GetError() << "\n";
+        return 1;
+    }
+    Mix_Init(MIX_INIT_OGG | MIX_INIT_MP3);
+    bool opened = false;
+    if (argc == 4) {
+        SDL_AudioSpec spec{SDL_AUDIO_F32, std::stoi(argv[3]), std::stoi(argv[2])};
+        opened = Mix_OpenAudio(0, &spec);
+    } else {
+        opened = Mix_OpenAudio(0, nullptr);
+    }
+    if (!opened) {
+        std::cerr << "Mix_OpenAudio 失败: " << SDL_GetError() << "\n";
+        Mix_Quit();
+        SDL_Quit();
+        return 1;
+    }
+
+    cooked::CookedAudioHeader header;
+    SDL_AudioFormat format = SDL_AUDIO_UNKNOWN;
+    Mix_QuerySpec(&header.frequency_, &format, &header.channels_);
+    header.format_ = format;
+    std::cout << "混音器格式: " << header.frequency_ << " Hz, 格式 0x" << std::hex << header.format_ << std::dec
+              << ", " << header.channels_ << " 声道\n\n";
+
+    // 2. 逐个解码、写出，并测量两种加载方式的耗时
+    double total_decode_ms = 0.0;
+    double total_cooked_ms = 0.0;
+    std::uint64_t total_bytes = 0;
+    int failed = 0;
+    for (const auto& sound_path : sounds) {
+        auto start = Clock::now();
+        Mix_Chunk* chunk = Mix_LoadWAV(sound_path.c_str());
+        double decode_ms = elapsedMs(start);
+        if (!chunk) {
+            std::cerr << "解码失败: " << sound_path << ": " << SDL_GetError() << "\n";
+            ++failed;
+            continue;
+        }
+
+        header.data_size_ = chunk->alen;
+        const std::string cooked_path = cooked::cookedSoundPath(sound_path);
+        bool written = writeCooked(cooked_path, header, chunk);
+        Mix_FreeChunk(chunk);
+        if (!written) {
+            std::cerr << "写入失败: " << cooked_path << "\n";
+            ++failed;
+            continue;
+        }
+
+        start = Clock::now();
+        Mix_Chunk* cooked_chunk = loadCooked(cooked_path);
+        double cooked_ms = elapsedMs(start);
+        Mix_FreeChunk(cooked_chunk);
+
+        total_decode_ms += decode_ms;
+        total_cooked_ms += cooked_ms;
+        total_bytes += header.data_size_;
+        std::printf("%-45s %8.1f KB  解码 %7.2f ms  预处理 %6.2f ms\n", sound_path.c_str(),
+                    header.data_size_ / 1024.0, decode_ms, cooked_ms);
+    }
+
+    std::printf("\n共 %zu 个音效（失败 %d），PCM %.1f KB\n", sounds.size(), failed, total_bytes / 1024.0);
+    std::printf("解码原始文件: %.2f ms   读取预处理 PCM: %.2f ms   (%.1fx)\n", total_decode_ms, total_cooked_ms,
+                total_cooked_ms > 0.0 ? total_decode_ms / total_cooked_ms : 0.0);
+
+    Mix_CloseAudio();
+    Mix_Quit();
+    SDL_Quit();
+    return failed == 0 ? 0 : 1;
+}